@@ -0,0 +1,505 @@
+// scan batch checks and compression benchmark
+//
+// runs the station batch encoder and decoder, see firmware/main/batch.cpp
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -I../firmware/main index.cpp -o batch
+//
+// usage:
+//
+//   ./batch check                     round trips, truncated and hostile batches
+//   ./batch benchmark [FILE...]       compression ratio and encode cost per tag sequence
+//
+// files hold one tag per line, as for the simulator, without files the benchmark runs on
+// generated sequences: sequential SSCC serials, several interleaved lines and random tags
+//
+// the check is meant to run under the sanitizers as well:
+//
+//   g++ -std=c++17 -O1 -g -fsanitize=address,undefined -I../firmware/main index.cpp -o batch
+
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "batch.cpp"
+#include "../host/check.cpp"
+
+// scans per second on a busy line, for the generated timestamps
+#define SCAN_RATE 40
+
+// mutated copies per valid batch in the hostile check
+#define MUTATIONS 2000
+
+struct Scan {
+	std::string tag;
+
+	// microseconds, as the station stamps scans
+	uint64_t time;
+};
+
+typedef std::vector<Scan> Sequence;
+
+static std::mt19937_64 random64(29);
+
+static uint64_t uniform(uint64_t limit) {
+	return random64() % limit;
+}
+
+// scan times of a busy line, exponential gaps
+static void stamp(Sequence *sequence) {
+	std::exponential_distribution<double> gap(SCAN_RATE / 1e6);
+	double time = 1700000000000000.0;
+
+	for (Scan &scan : *sequence) {
+		time += gap(random64);
+		scan.time = (uint64_t)time;
+	}
+}
+
+// one line, GS1 SSCC: extension digit, company prefix and serial, mostly in order
+static Sequence sscc(size_t count) {
+	Sequence sequence;
+	uint64_t serial = 4711000;
+
+	for (size_t index = 0; index < count; index++) {
+		// a skipped or rescanned label now and then
+		serial += uniform(10) == 0 ? uniform(5) : 1;
+
+		char tag[32];
+		snprintf(tag, sizeof(tag), "00340123450%09llu", (unsigned long long)serial);
+		sequence.push_back({ tag, 0 });
+	}
+
+	stamp(&sequence);
+
+	return sequence;
+}
+
+// several lines merging onto one belt, every one with its own serials
+static Sequence interleaved(size_t count) {
+	const char *stems[] = { "ST00042-", "PAL-DE-", "RT", "00340123450" };
+	uint64_t serials[] = { 100000, 5000, 880000000, 4711000 };
+	int digits[] = { 6, 6, 9, 9 };
+
+	Sequence sequence;
+	size_t line = 0;
+
+	for (size_t index = 0; index < count; index++) {
+		// lines hand over in runs
+		if (uniform(4) == 0) {
+			line = uniform(4);
+		}
+
+		char tag[32];
+		snprintf(tag, sizeof(tag), "%s%0*llu", stems[line], digits[line], (unsigned long long)serials[line]++);
+		sequence.push_back({ tag, 0 });
+	}
+
+	stamp(&sequence);
+
+	return sequence;
+}
+
+// worst case, nothing shared between tags
+static Sequence randomTags(size_t count) {
+	const char *alphabet = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	Sequence sequence;
+
+	for (size_t index = 0; index < count; index++) {
+		std::string tag;
+		size_t length = 8 + uniform(17);
+
+		for (size_t character = 0; character < length; character++) {
+			tag += alphabet[uniform(36)];
+		}
+
+		sequence.push_back({ tag, 0 });
+	}
+
+	stamp(&sequence);
+
+	return sequence;
+}
+
+static bool load(const char *path, Sequence *sequence) {
+	std::ifstream file(path);
+
+	if (!file) {
+		perror(path);
+
+		return false;
+	}
+
+	std::string line;
+
+	while (std::getline(file, line)) {
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+
+		if (!line.empty() && line.size() <= BATCH_TAG_LIMIT) {
+			sequence->push_back({ line, 0 });
+		}
+	}
+
+	stamp(sequence);
+
+	return true;
+}
+
+// cuts a sequence into batches as the uplink does, by size, record count and latency
+static std::vector<std::vector<uint8_t>> encode(const Sequence &sequence) {
+	std::vector<std::vector<uint8_t>> batches;
+
+	uint8_t buffer[BATCH_SIZE_LIMIT];
+	BatchEncoder encoder;
+
+	uint64_t opened = 0;
+	bool open = false;
+
+	for (const Scan &scan : sequence) {
+		if (open && (encoder.count == BATCH_RECORD_LIMIT || scan.time - opened >= BATCH_LATENCY_MS * 1000)) {
+			size_t length = encoder.finish();
+			batches.emplace_back(buffer, buffer + length);
+			open = false;
+		}
+
+		if (!open) {
+			encoder.begin(buffer, sizeof(buffer), scan.time);
+			opened = scan.time;
+			open = true;
+		}
+
+		// a scan that does not fit opens the next batch
+		if (!encoder.append(scan.tag.data(), scan.tag.size(), scan.time)) {
+			size_t length = encoder.finish();
+			batches.emplace_back(buffer, buffer + length);
+
+			encoder.begin(buffer, sizeof(buffer), scan.time);
+			opened = scan.time;
+
+			encoder.append(scan.tag.data(), scan.tag.size(), scan.time);
+		}
+	}
+
+	if (open) {
+		size_t length = encoder.finish();
+		batches.emplace_back(buffer, buffer + length);
+	}
+
+	return batches;
+}
+
+// decodes a batch completely, false on malformed input
+static bool decode(const uint8_t *data, size_t length, Sequence *records) {
+	BatchDecoder decoder;
+
+	if (!decoder.open(data, length)) {
+		return false;
+	}
+
+	for (uint16_t index = 0; index < decoder.count; index++) {
+		if (!decoder.next()) {
+			return false;
+		}
+
+		if (decoder.tagLength > BATCH_TAG_LIMIT) {
+			return false;
+		}
+
+		records->push_back({ std::string(decoder.tag, decoder.tagLength), decoder.time });
+	}
+
+	return true;
+}
+
+static void checkRoundTrip(const char *name, const Sequence &sequence) {
+	Sequence decoded;
+
+	for (const std::vector<uint8_t> &batch : encode(sequence)) {
+		expect(batch.size() <= BATCH_SIZE_LIMIT, name, "batch over the size limit");
+		expect(decode(batch.data(), batch.size(), &decoded), name, "valid batch rejected");
+	}
+
+	bool equal = decoded.size() == sequence.size();
+
+	for (size_t index = 0; equal && index < decoded.size(); index++) {
+		equal = decoded[index].tag == sequence[index].tag && decoded[index].time == sequence[index].time;
+	}
+
+	expect(equal, name, "records differ after the round trip");
+}
+
+// every cut of a valid batch is rejected, except the one that keeps all of it
+static void checkTruncated(const char *name, const Sequence &sequence) {
+	for (const std::vector<uint8_t> &batch : encode(sequence)) {
+		for (size_t length = 0; length < batch.size(); length++) {
+			// a copy of exactly the cut length, so the sanitizers see any read past it
+			std::vector<uint8_t> cut(batch.begin(), batch.begin() + length);
+			Sequence decoded;
+
+			expect(!decode(cut.data(), cut.size(), &decoded), name, "truncated batch accepted");
+		}
+	}
+}
+
+// mutated batches may decode to anything, but only within bounds, the sanitizers tell
+static void checkMutated(const Sequence &sequence) {
+	std::vector<std::vector<uint8_t>> batches = encode(sequence);
+
+	for (size_t index = 0; index < batches.size() && index < 8; index++) {
+		for (int mutation = 0; mutation < MUTATIONS; mutation++) {
+			std::vector<uint8_t> batch = batches[index];
+			int changes = 1 + uniform(4);
+
+			for (int change = 0; change < changes; change++) {
+				size_t position = uniform(batch.size());
+
+				switch (uniform(3)) {
+					case 0: batch[position] = uniform(256); break;
+					case 1: batch[position] |= 0x80; break;
+					case 2: batch.resize(position + 1); break;
+				}
+			}
+
+			Sequence decoded;
+			decode(batch.data(), batch.size(), &decoded);
+		}
+	}
+
+	// pure noise behind a valid header
+	for (int mutation = 0; mutation < MUTATIONS; mutation++) {
+		std::vector<uint8_t> batch(BATCH_HEADER_SIZE + uniform(64));
+
+		for (uint8_t &byte : batch) {
+			byte = uniform(256);
+		}
+
+		batch[0] = BATCH_MAGIC;
+
+		Sequence decoded;
+		decode(batch.data(), batch.size(), &decoded);
+	}
+}
+
+// hand built batches, each one aimed at a single check of the decoder
+static void checkHostile() {
+	struct Case {
+		const char *name;
+		std::vector<uint8_t> data;
+	};
+
+	// magic, one record, base time 0, elapsed 0
+	std::vector<uint8_t> one = { BATCH_MAGIC, 1, 0, 0, 0 };
+	std::vector<uint8_t> two = { BATCH_MAGIC, 2, 0, 0, 0 };
+
+	auto with = [](std::vector<uint8_t> data, std::vector<uint8_t> tail) {
+		data.insert(data.end(), tail.begin(), tail.end());
+		return data;
+	};
+
+	std::vector<Case> cases = {
+		// shared + suffix and offset + suffix both wrap back into range
+		{ "suffix near 2^64", with(two, { 0x00, 0x01, 'A', 0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 'B' }) },
+		{ "suffix over the tag limit", with(one, { 0x00, 0x81, 0x02, 'A' }) },
+		{ "suffix past the end", with(one, { 0x00, 0x05, 'A', 'B' }) },
+		{ "shared without a previous tag", with(one, { 0x02, 0x01, 'A' }) },
+		{ "shared near 2^64", with(two, { 0x00, 0x01, 'A', 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00 }) },
+		{ "delta without digits", with(two, { 0x00, 0x01, 'A', 0x00, 0x03 }) },
+		{ "delta below zero", with(two, { 0x00, 0x01, '5', 0x00, 0x17 }) },
+		{ "delta past the digits", with(two, { 0x00, 0x01, '5', 0x00, 0x19 }) },
+		{ "delta near 2^63", with(two, { 0x00, 0x01, '5', 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01 }) },
+		{ "delta near -2^63", with(two, { 0x00, 0x01, '5', 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01 }) },
+		{ "varint without end", with(one, { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 }) },
+		{ "more records than data", { BATCH_MAGIC, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 'A' } },
+		{ "wrong magic", { 0x00, 0x00, 0x00, 0x00 } },
+		{ "header only", { BATCH_MAGIC, 0x01 } },
+	};
+
+	for (const Case &entry : cases) {
+		Sequence decoded;
+
+		// exact size copies, reads past the end show under the sanitizers
+		std::vector<uint8_t> data = entry.data;
+
+		expect(!decode(data.data(), data.size(), &decoded), entry.name, "malformed batch accepted");
+	}
+
+	// the largest valid forms still pass
+	std::string longest(BATCH_TAG_LIMIT, 'X');
+	longest.replace(BATCH_TAG_LIMIT - BATCH_NUMBER_DIGITS, BATCH_NUMBER_DIGITS, BATCH_NUMBER_DIGITS, '0');
+
+	std::string highest = longest;
+	highest.replace(BATCH_TAG_LIMIT - BATCH_NUMBER_DIGITS, BATCH_NUMBER_DIGITS, BATCH_NUMBER_DIGITS, '9');
+
+	checkRoundTrip("longest tags", { { longest, 1 }, { highest, 2 }, { longest, 3 } });
+
+	// a delta of exactly the digit range is valid, one more is not
+	std::vector<uint8_t> edge = with(two, { 0x00, 0x01, '5', 0x00 });
+	uint8_t varint[10];
+
+	std::vector<uint8_t> up = edge;
+	up.insert(up.end(), varint, varint + batchPutVarint(varint, (zigzagEncode(4) << 1) | 1));
+
+	std::vector<uint8_t> over = edge;
+	over.insert(over.end(), varint, varint + batchPutVarint(varint, (zigzagEncode(5) << 1) | 1));
+
+	Sequence decoded;
+	expect(decode(up.data(), up.size(), &decoded) && decoded.back().tag == "9", "delta to the last digit", "rejected");
+	expect(!decode(over.data(), over.size(), &decoded), "delta past the last digit", "accepted");
+}
+
+static int check() {
+	std::vector<std::pair<const char *, Sequence>> sequences = {
+		{ "sscc", sscc(2000) },
+		{ "interleaved", interleaved(2000) },
+		{ "random", randomTags(2000) },
+		{ "empty", {} },
+	};
+
+	for (const auto &entry : sequences) {
+		checkRoundTrip(entry.first, entry.second);
+		checkTruncated(entry.first, Sequence(entry.second.begin(), entry.second.begin() + std::min<size_t>(200, entry.second.size())));
+		checkMutated(entry.second);
+	}
+
+	checkHostile();
+
+	return checkResult();
+}
+
+static void measure(const char *name, const Sequence &sequence) {
+	if (sequence.empty()) {
+		return;
+	}
+
+	// one message per scan, as before batching: length byte, tag and 64 bit time
+	size_t raw = 0;
+
+	for (const Scan &scan : sequence) {
+		raw += 1 + scan.tag.size() + 8;
+	}
+
+	std::vector<std::vector<uint8_t>> batches = encode(sequence);
+	size_t encoded = 0;
+
+	for (const std::vector<uint8_t> &batch : batches) {
+		// the uplink frames every batch with its 16 bit length
+		encoded += 2 + batch.size();
+	}
+
+	// encode cost alone, the sequence is appended into batches until it has run a while
+	uint8_t buffer[BATCH_SIZE_LIMIT];
+	BatchEncoder encoder;
+
+	size_t appended = 0;
+	size_t checksum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	auto end = start;
+
+	do {
+		encoder.begin(buffer, sizeof(buffer), sequence[0].time);
+
+		for (const Scan &scan : sequence) {
+			if (encoder.count == BATCH_RECORD_LIMIT || !encoder.append(scan.tag.data(), scan.tag.size(), scan.time)) {
+				checksum += encoder.finish();
+				encoder.begin(buffer, sizeof(buffer), scan.time);
+				encoder.append(scan.tag.data(), scan.tag.size(), scan.time);
+			}
+		}
+
+		checksum += encoder.finish();
+		appended += sequence.size();
+
+		end = std::chrono::steady_clock::now();
+	} while (end - start < std::chrono::milliseconds(500));
+
+	double encodeTime = std::chrono::duration<double, std::nano>(end - start).count() / appended;
+
+	// decode cost, for the collector
+	size_t decodedRecords = 0;
+	start = std::chrono::steady_clock::now();
+
+	do {
+		for (const std::vector<uint8_t> &batch : batches) {
+			BatchDecoder decoder;
+			decoder.open(batch.data(), batch.size());
+
+			while (decoder.next()) {
+				checksum += decoder.tagLength;
+				decodedRecords++;
+			}
+		}
+
+		end = std::chrono::steady_clock::now();
+	} while (end - start < std::chrono::milliseconds(500));
+
+	double decodeTime = std::chrono::duration<double, std::nano>(end - start).count() / decodedRecords;
+
+	double tagLength = 0;
+
+	for (const Scan &scan : sequence) {
+		tagLength += scan.tag.size();
+	}
+
+	printf("%-14s %7zu %6.1f %9zu %9zu %6.2fx %7.1f %9.0f %9.0f\n",
+		name, sequence.size(), tagLength / sequence.size(),
+		raw, encoded, (double)raw / encoded, (double)encoded / sequence.size(),
+		encodeTime, decodeTime
+	);
+
+	// keeps the loops from being optimized out
+	fprintf(stderr, "%s checksum %zu\n", name, checksum);
+}
+
+static int benchmark(int count, char **paths) {
+	printf("%d scans/s, batches of up to %d bytes, %d records or %d ms\n", SCAN_RATE, BATCH_SIZE_LIMIT, BATCH_RECORD_LIMIT, BATCH_LATENCY_MS);
+	printf("raw is one message per scan: length byte, tag and 64 bit time\n\n");
+
+	printf("%-14s %7s %6s %9s %9s %7s %7s %9s %9s\n",
+		"sequence", "scans", "length", "raw", "batched", "ratio", "B/scan", "encode ns", "decode ns"
+	);
+
+	if (count == 0) {
+		measure("sscc", sscc(100000));
+		measure("interleaved", interleaved(100000));
+		measure("random", randomTags(100000));
+
+		return 0;
+	}
+
+	for (int index = 0; index < count; index++) {
+		Sequence sequence;
+
+		if (!load(paths[index], &sequence)) {
+			return 1;
+		}
+
+		measure(paths[index], sequence);
+	}
+
+	return 0;
+}
+
+int main(int count, char **arguments) {
+	std::string mode = count > 1 ? arguments[1] : "";
+
+	if (mode == "check" && count == 2) {
+		return check();
+	}
+
+	if (mode == "benchmark") {
+		return benchmark(count - 2, arguments + 2);
+	}
+
+	fprintf(stderr, "usage: %s check | benchmark [FILE...]\n", arguments[0]);
+
+	return 1;
+}
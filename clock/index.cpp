@@ -0,0 +1,311 @@
+// time server stand-in and clock sync validation
+//
+// serves the station time protocol, see firmware/main/timebase.cpp, with injected network
+// jitter, and checks the station estimator against it with a local clock that is offset and
+// drifts
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -pthread -I../firmware/main index.cpp -o clock
+//
+// usage:
+//
+//   ./clock serve [options]       answers stations, CLOCK_PORT by default
+//   ./clock validate [options]    runs the estimator against a local server, reports the error
+//
+//   --port P          server port (CLOCK_PORT for serve, any for validate)
+//   --jitter US       mean extra delay per direction, exponential (2000)
+//   --base US         fixed delay per direction (300)
+//   --drift PPM       local clock drift for validate (80)
+//   --poll MS         time between exchanges for validate (250)
+//   --duration S      validate run time (120)
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "timebase.cpp"
+
+// samples before the estimator counts as settled
+#define VALIDATE_SETTLE 8
+
+struct Options {
+	int port = -1;
+	double jitter = 2000;
+	double base = 300;
+	double drift = 80;
+	int poll = 250;
+	double duration = 120;
+};
+
+static Options options;
+
+// the collector clock, microseconds since the unix epoch
+static int64_t serverTime() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::system_clock::now().time_since_epoch()
+	).count();
+}
+
+// answers requests, both directions get a random delay as if the packets queued on the way
+class Server {
+	public:
+		uint16_t port = 0;
+		std::atomic<uint64_t> answered { 0 };
+
+		void begin(int port);
+		void run();
+
+	private:
+		struct Pending {
+			int64_t due;
+
+			uint8_t response[CLOCK_RESPONSE_SIZE];
+			struct sockaddr_in address;
+
+			bool operator<(const Pending &other) const {
+				return this->due > other.due;
+			}
+		};
+
+		int descriptor = -1;
+
+		std::mt19937 random { 1 };
+		std::priority_queue<Pending> pending;
+
+		int64_t delay();
+};
+
+void Server::begin(int port) {
+	this->descriptor = socket(AF_INET, SOCK_DGRAM, 0);
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	if (bind(this->descriptor, (struct sockaddr *)&address, sizeof(address)) != 0) {
+		perror("server");
+		exit(1);
+	}
+
+	socklen_t length = sizeof(address);
+	getsockname(this->descriptor, (struct sockaddr *)&address, &length);
+
+	this->port = ntohs(address.sin_port);
+}
+
+int64_t Server::delay() {
+	std::exponential_distribution<double> jitter(1.0 / std::max(options.jitter, 1.0));
+
+	return options.base + (options.jitter > 0 ? jitter(this->random) : 0);
+}
+
+void Server::run() {
+	while (true) {
+		int64_t now = serverTime();
+
+		while (!this->pending.empty() && this->pending.top().due <= now) {
+			const Pending &next = this->pending.top();
+
+			sendto(this->descriptor, next.response, CLOCK_RESPONSE_SIZE, 0, (struct sockaddr *)&next.address, sizeof(next.address));
+
+			this->pending.pop();
+			this->answered++;
+		}
+
+		int timeout = this->pending.empty() ? 100 : std::max<int64_t>(0, (this->pending.top().due - now) / 1000);
+
+		struct pollfd ready = { this->descriptor, POLLIN, 0 };
+
+		if (poll(&ready, 1, timeout) <= 0) {
+			continue;
+		}
+
+		uint8_t request[64];
+		Pending answer;
+		socklen_t length = sizeof(answer.address);
+
+		ssize_t size = recvfrom(this->descriptor, request, sizeof(request), 0, (struct sockaddr *)&answer.address, &length);
+
+		if (size != CLOCK_REQUEST_SIZE || request[0] != CLOCK_MAGIC) {
+			continue;
+		}
+
+		// the request arrives late, the response leaves late
+		int64_t received = serverTime() + this->delay();
+		int64_t sent = received + 20;
+
+		memcpy(answer.response, request, CLOCK_REQUEST_SIZE);
+		clockPut(answer.response + 11, received);
+		clockPut(answer.response + 19, sent);
+
+		answer.due = sent + this->delay();
+		this->pending.push(answer);
+	}
+}
+
+static Server server;
+
+static double percentile(std::vector<double> values, double fraction) {
+	if (values.empty()) {
+		return 0;
+	}
+
+	size_t index = std::min(values.size() - 1, (size_t)(fraction * values.size()));
+	std::nth_element(values.begin(), values.begin() + index, values.end());
+
+	return values[index];
+}
+
+// runs the station side with a drifting clock and compares its synced time with the server
+static int validate() {
+	server.begin(options.port < 0 ? 0 : options.port);
+	std::thread([] { server.run(); }).detach();
+
+	int descriptor = socket(AF_INET, SOCK_DGRAM, 0);
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(server.port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	connect(descriptor, (struct sockaddr *)&address, sizeof(address));
+
+	struct timeval timeout = { 0, 500000 };
+	setsockopt(descriptor, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+	// the station clock starts at boot and runs off by the drift
+	const auto boot = std::chrono::steady_clock::now();
+	const double rate = 1 + options.drift / 1e6;
+
+	auto local = [&]() {
+		return (int64_t)(std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - boot
+		).count() * rate);
+	};
+
+	ClockEstimator estimator;
+	Timebase timebase;
+
+	std::vector<double> errors;
+	uint32_t accepted = 0;
+	uint16_t sequence = 0;
+
+	const auto end = boot + std::chrono::milliseconds((int64_t)(options.duration * 1000));
+
+	while (std::chrono::steady_clock::now() < end) {
+		uint8_t request[CLOCK_REQUEST_SIZE];
+		int64_t t1 = local();
+
+		sequence++;
+
+		request[0] = CLOCK_MAGIC;
+		request[1] = sequence >> 8;
+		request[2] = sequence & 0xff;
+		clockPut(request + 3, t1);
+
+		send(descriptor, request, sizeof(request), 0);
+
+		uint8_t response[CLOCK_RESPONSE_SIZE];
+
+		while (recv(descriptor, response, sizeof(response), 0) == CLOCK_RESPONSE_SIZE) {
+			if (((response[1] << 8) | response[2]) != sequence) {
+				continue;
+			}
+
+			int64_t t4 = local();
+
+			TimebaseParameters parameters;
+
+			if (estimator.add(t1, clockGet(response + 11), clockGet(response + 19), t4, &parameters)) {
+				timebase.publish(&parameters);
+				accepted++;
+			}
+
+			break;
+		}
+
+		// error of a scan timestamp taken halfway to the next exchange
+		std::this_thread::sleep_for(std::chrono::milliseconds(options.poll / 2));
+
+		if (accepted >= VALIDATE_SETTLE) {
+			int64_t synced = timebase.convert(local());
+			errors.push_back(std::fabs((double)(synced - serverTime())));
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(options.poll - options.poll / 2));
+	}
+
+	printf("exchanges %u, accepted %u, rejected for delay %u\n", estimator.samples, accepted, estimator.rejected);
+	printf("absolute error us: p50 %.0f, p90 %.0f, p99 %.0f, max %.0f\n",
+		percentile(errors, 0.5),
+		percentile(errors, 0.9),
+		percentile(errors, 0.99),
+		percentile(errors, 1)
+	);
+
+	return 0;
+}
+
+static bool parseOptions(int count, char **arguments) {
+	for (int index = 2; index + 1 < count; index += 2) {
+		std::string name = arguments[index];
+		const char *value = arguments[index + 1];
+
+		if (name == "--port") {
+			options.port = atoi(value);
+		} else if (name == "--jitter") {
+			options.jitter = atof(value);
+		} else if (name == "--base") {
+			options.base = atof(value);
+		} else if (name == "--drift") {
+			options.drift = atof(value);
+		} else if (name == "--poll") {
+			options.poll = std::max(2, atoi(value));
+		} else if (name == "--duration") {
+			options.duration = atof(value);
+		} else {
+			return false;
+		}
+	}
+
+	return count % 2 == 0;
+}
+
+int main(int count, char **arguments) {
+	std::string mode = count > 1 ? arguments[1] : "";
+
+	if ((mode != "serve" && mode != "validate") || !parseOptions(count, arguments)) {
+		fprintf(stderr, "usage: %s serve|validate [--port P] [--jitter US] [--base US] [--drift PPM] [--poll MS] [--duration S]\n", arguments[0]);
+
+		return 1;
+	}
+
+	if (mode == "validate") {
+		return validate();
+	}
+
+	server.begin(options.port < 0 ? CLOCK_PORT : options.port);
+	printf("serving on port %u, %.0f us base delay, %.0f us mean jitter\n", server.port, options.base, options.jitter);
+
+	server.run();
+
+	return 0;
+}
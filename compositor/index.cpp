@@ -0,0 +1,241 @@
+// dirty region checks on the host
+//
+// runs the station compositor, see firmware/main/compositor.cpp, through scripted widget
+// updates and pushes the collected regions the way the display does, in stripes of at most
+// one frame, then counts the transfers and bytes that would go to the panel
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -I../firmware/main index.cpp -o compositor
+//
+// usage:
+//
+//   ./compositor    runs every script, prints transfers and bytes next to one transfer per
+//                   invalidated region, fails when a pushed frame misses an invalidated pixel
+//
+// the cost columns add COMPOSITOR_TRANSFER_COST pixels per transfer, the figure merging minimizes
+
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "compositor.cpp"
+#include "../host/check.cpp"
+
+// panel and frame as in display.cpp
+#define LCD_WIDTH 480
+#define LCD_HEIGHT 320
+#define FRAME_LINES 128
+#define DISPLAY_REFRESH_MS 30
+
+// top of the lookup widget, below the tag widget
+#define LOOKUP_TOP (FRAME_LINES + 10)
+
+struct Step {
+	// milliseconds since the script started
+	uint64_t time;
+
+	// regions invalidated before the refresh at this time, none for a plain refresh
+	std::vector<Region> regions;
+};
+
+struct Script {
+	const char *name;
+	const char *description;
+
+	std::vector<Step> steps;
+
+	// expected transfers over the whole script, -1 when only the totals matter
+	int transfers;
+};
+
+// invalidated pixels not yet pushed, one byte per panel pixel
+struct Panel {
+	std::vector<uint8_t> stale = std::vector<uint8_t>(LCD_WIDTH * LCD_HEIGHT);
+
+	void mark(Region region, uint8_t value) {
+		for (int y = region.y; y < region.y + region.height; y++) {
+			memset(&this->stale[y * LCD_WIDTH + region.x], value, region.width);
+		}
+	}
+
+	bool clean() const {
+		for (uint8_t pixel : this->stale) {
+			if (pixel) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+};
+
+struct Totals {
+	int transfers = 0;
+	uint64_t bytes = 0;
+
+	int invalidated = 0;
+	uint64_t invalidatedBytes = 0;
+};
+
+// bytes plus the fixed cost of every transfer, in bytes as well
+static uint64_t cost(int transfers, uint64_t bytes) {
+	return bytes + (uint64_t)transfers * COMPOSITOR_TRANSFER_COST * sizeof(uint16_t);
+}
+
+// the stripes display.cpp pushes for one collected region
+static void push(Region region, Panel *panel, Totals *totals) {
+	uint16_t lines = MIN(region.height, LCD_WIDTH * FRAME_LINES / region.width);
+
+	for (uint16_t top = 0; top < region.height; top += lines) {
+		totals->transfers++;
+		totals->bytes += (uint64_t)region.width * MIN(lines, region.height - top) * sizeof(uint16_t);
+	}
+
+	panel->mark(region, 0);
+}
+
+static void run(const Script *script) {
+	Compositor compositor;
+	compositor.begin(LCD_WIDTH * FRAME_LINES, DISPLAY_REFRESH_MS);
+
+	Panel panel;
+	Totals totals;
+
+	for (const Step &step : script->steps) {
+		for (Region region : step.regions) {
+			compositor.invalidate(region);
+			panel.mark(region, 1);
+
+			if (!regionEmpty(region)) {
+				totals.invalidated++;
+				totals.invalidatedBytes += regionArea(region) * sizeof(uint16_t);
+			}
+		}
+
+		Region regions[COMPOSITOR_REGION_LIMIT];
+		uint8_t count = compositor.collect(regions, step.time);
+
+		expect(count <= COMPOSITOR_REGION_LIMIT, script->name, "more regions than the limit");
+
+		for (uint8_t index = 0; index < count; index++) {
+			expect(!regionEmpty(regions[index]), script->name, "empty region collected");
+			expect(regions[index].x + regions[index].width <= LCD_WIDTH && regions[index].y + regions[index].height <= LCD_HEIGHT, script->name, "region outside the panel");
+
+			push(regions[index], &panel, &totals);
+		}
+	}
+
+	expect(!compositor.pending(), script->name, "regions left after the last refresh");
+	expect(panel.clean(), script->name, "invalidated pixels never pushed");
+
+	if (script->transfers >= 0 && totals.transfers != script->transfers) {
+		printf("FAIL %s: %d transfers, expected %d\n", script->name, totals.transfers, script->transfers);
+		failures++;
+	}
+
+	printf(
+		"%-12s %3d transfers %8llu bytes %8llu cost   unmerged %3d transfers %8llu bytes %8llu cost   %s\n",
+		script->name,
+		totals.transfers, (unsigned long long)totals.bytes, (unsigned long long)cost(totals.transfers, totals.bytes),
+		totals.invalidated, (unsigned long long)totals.invalidatedBytes, (unsigned long long)cost(totals.invalidated, totals.invalidatedBytes),
+		script->description
+	);
+}
+
+// the tag widget replacing a tag of one width by one of another, both from the left edge
+static Region tagInk(uint16_t width) {
+	return { 10, 0, width, 51 };
+}
+
+static Region lookupInk(uint16_t width) {
+	return { 10, LOOKUP_TOP, width, 51 };
+}
+
+static std::vector<Script> scripts() {
+	std::vector<Script> scripts;
+
+	// the old and the new tag overlap, one transfer of the wider one
+	scripts.push_back({ "overlap", "new tag over the old one", {
+		{ 0, { tagInk(300), tagInk(176) } }
+	}, 1 });
+
+	// regions side by side, the union pushes no extra pixel and saves a transfer
+	scripts.push_back({ "adjacent", "two regions of one line, touching", {
+		{ 0, { { 10, 0, 200, 51 }, { 210, 0, 150, 51 } } }
+	}, 1 });
+
+	// a short tag and a short answer far apart, the union would push the gap
+	scripts.push_back({ "apart", "short tag and answer, panel rows apart", {
+		{ 0, { tagInk(66), { 300, 260, 44, 51 } } }
+	}, 2 });
+
+	// tag and answer as the loop sets them, the tag overlaps its predecessor, the gap
+	// between the widgets costs more than a transfer
+	scripts.push_back({ "scan", "tag and answer in the same refresh", {
+		{ 0, { tagInk(176), tagInk(220), lookupInk(0), lookupInk(264) } }
+	}, 2 });
+
+	// more regions than the list holds, the rest are folded into their closest partner
+	{
+		std::vector<Region> regions;
+
+		for (int index = 0; index < COMPOSITOR_REGION_LIMIT + 8; index++) {
+			regions.push_back({ (uint16_t)(index % 6 * 80), (uint16_t)(index / 6 * 80), 8, 8 });
+		}
+
+		scripts.push_back({ "full list", "24 small regions spread over the panel", {
+			{ 0, regions }
+		}, -1 });
+	}
+
+	// changes within the interval wait for it and go out together, the blank answer line
+	// and both answers after it take one transfer at 30 ms
+	scripts.push_back({ "rate limit", "miss, then the answer 5 to 25 ms later", {
+		{ 0, { tagInk(176), lookupInk(264) } },
+		{ 5, { lookupInk(264), lookupInk(0) } },
+		{ 12, {} },
+		{ 25, { lookupInk(0), lookupInk(308) } },
+		{ 29, {} },
+		{ 30, {} }
+	}, 3 });
+
+	// a scan every 20 ms, refreshes every 2 ms as the main loop does
+	{
+		std::vector<Step> steps;
+		uint16_t previous = 0;
+
+		for (uint64_t time = 0; time < 1000; time += 2) {
+			Step step = { time, {} };
+
+			if (time % 20 == 0) {
+				uint16_t width = 88 + (time / 20 % 7) * 22;
+
+				step.regions = { tagInk(previous), tagInk(width) };
+				previous = width;
+			}
+
+			steps.push_back(step);
+		}
+
+		scripts.push_back({ "burst", "a tag every 20 ms for one second", steps, 34 });
+	}
+
+	return scripts;
+}
+
+int main(int count, char **arguments) {
+	if (count != 1) {
+		fprintf(stderr, "usage: %s\n", arguments[0]);
+
+		return 1;
+	}
+
+	for (const Script &script : scripts()) {
+		run(&script);
+	}
+
+	return checkResult();
+}
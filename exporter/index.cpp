@@ -0,0 +1,575 @@
+// metrics endpoint checks on the host
+//
+// serves the station metrics, see firmware/main/prometheus.cpp, from a snapshot on a loopback
+// socket the way the exporter task does, scrapes it over HTTP and checks the text format
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -pthread -I../firmware/main index.cpp -o exporter
+//
+// usage:
+//
+//   ./exporter check                 scrapes empty, typical and largest snapshots, checks every
+//                                    line, HELP and TYPE pairs and the histogram buckets
+//   ./exporter benchmark [COUNT]     scrapes COUNT times (2000), reports format and scrape time
+//   ./exporter serve [PORT]          serves a typical snapshot, for curl or promtool
+//
+// the host formats far faster than the station, the ratio of format time to scrape time and
+// the body size carry over, the absolute times do not
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "prometheus.cpp"
+#include "../host/check.cpp"
+
+static void fillHistogram(HistogramSnapshot *histogram, std::mt19937 *random, uint32_t count, int center) {
+	*histogram = {};
+
+	std::normal_distribution<double> bucket(center, 1.5);
+
+	for (uint32_t index = 0; index < count; index++) {
+		int value = std::clamp((int)bucket(*random), 0, HISTOGRAM_BUCKETS - 1);
+
+		histogram->buckets[value]++;
+		histogram->sum += (1u << value) * 3 / 4;
+	}
+}
+
+// a station after a day of scanning
+static MetricsSnapshot typicalSnapshot() {
+	std::mt19937 random(3);
+	MetricsSnapshot snapshot = {};
+
+	snapshot.scansDecoded = 48213;
+	snapshot.scansDropped = 2;
+	snapshot.scansTruncated = 1;
+	snapshot.scansRendered = 48190;
+
+	snapshot.uplinkQueue = 3;
+	snapshot.lookupQueue = 1;
+	snapshot.arenaUsed = 412;
+
+	fillHistogram(&snapshot.renderTime, &random, 96000, 10);
+	fillHistogram(&snapshot.transferTime, &random, 96000, 13);
+	fillHistogram(&snapshot.lookupAnswerTime, &random, 31000, 14);
+	fillHistogram(&snapshot.lookupDisplayTime, &random, 48000, 15);
+
+	snapshot.displayTransfers = 96120;
+	snapshot.displayBytes = 1874201344;
+
+	snapshot.uplinkBatches = 5120;
+	snapshot.uplinkScans = 48211;
+	snapshot.uplinkBytes = 1388320;
+
+	snapshot.lookupHits = 17102;
+	snapshot.lookupMisses = 31111;
+	snapshot.lookupTimeouts = 14;
+
+	snapshot.heapFree[0] = 182344;
+	snapshot.heapFree[1] = 171200;
+	snapshot.heapLargestBlock[0] = 110592;
+	snapshot.heapLargestBlock[1] = 110592;
+
+	snapshot.clockSynced = true;
+	snapshot.clockOffset = -1734460221000;
+	snapshot.clockDrift = -41233;
+	snapshot.clockDelay = 812;
+	snapshot.clockSamples = 345600;
+	snapshot.clockRejected = 20113;
+	snapshot.clockTimeouts = 9;
+
+	snapshot.linkUp = true;
+	snapshot.uptime = 86400;
+	snapshot.lastScrape = 1480;
+
+	return snapshot;
+}
+
+// every field at its widest, the body has to fit all of it
+static MetricsSnapshot largestSnapshot() {
+	MetricsSnapshot snapshot;
+	memset(&snapshot, 0xff, sizeof(snapshot));
+
+	snapshot.clockSynced = true;
+	snapshot.linkUp = true;
+
+	// widest negative numbers
+	snapshot.clockOffset = INT64_MIN;
+	snapshot.clockDrift = INT64_MIN;
+	snapshot.clockDelay = INT64_MIN;
+	snapshot.uptime = INT64_MIN;
+
+	// the cumulative counts wrap like the station counters, only the last bucket is filled
+	for (HistogramSnapshot *histogram : { &snapshot.renderTime, &snapshot.transferTime, &snapshot.lookupAnswerTime, &snapshot.lookupDisplayTime }) {
+		memset(histogram->buckets, 0, sizeof(histogram->buckets));
+		histogram->buckets[HISTOGRAM_BUCKETS - 1] = UINT32_MAX;
+	}
+
+	return snapshot;
+}
+
+// loopback endpoint, one scrape at a time as on the station
+class Server {
+	public:
+		uint16_t port = 0;
+
+		// time spent in format for the last scrape, microseconds
+		double formatTime = 0;
+
+		bool begin(uint16_t port) {
+			this->listener = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+
+			struct sockaddr_in address = {};
+			address.sin_family = AF_INET;
+			address.sin_port = htons(port);
+			address.sin_addr.s_addr = htonl(port ? INADDR_ANY : INADDR_LOOPBACK);
+
+			int enable = 1;
+			setsockopt(this->listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+			socklen_t length = sizeof(address);
+
+			if (
+				this->listener < 0 ||
+				bind(this->listener, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+				listen(this->listener, 2) != 0 ||
+				getsockname(this->listener, (struct sockaddr *)&address, &length) != 0
+			) {
+				perror("listen");
+
+				return false;
+			}
+
+			this->port = ntohs(address.sin_port);
+
+			return true;
+		}
+
+		// as Exporter::serve, without the trace dump
+		void serve(const MetricsSnapshot *snapshot) {
+			int client = accept(this->listener, NULL, NULL);
+
+			if (client < 0) {
+				return;
+			}
+
+			char request[256];
+			recv(client, request, sizeof(request) - 1, 0);
+
+			auto start = std::chrono::steady_clock::now();
+			this->metrics.format(snapshot);
+			auto end = std::chrono::steady_clock::now();
+
+			this->formatTime = std::chrono::duration<double, std::micro>(end - start).count();
+			this->metrics.send(client);
+
+			shutdown(client, 0);
+			close(client);
+		}
+
+		bool truncated() const {
+			return this->metrics.truncated;
+		}
+
+	private:
+		int listener = -1;
+		MetricsBody metrics;
+};
+
+// one HTTP scrape, the response body or an empty string
+static std::string scrape(uint16_t port) {
+	int client = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (connect(client, (struct sockaddr *)&address, sizeof(address)) != 0) {
+		close(client);
+
+		return "";
+	}
+
+	const char *request = "GET /metrics HTTP/1.0\r\n\r\n";
+	send(client, request, strlen(request), 0);
+
+	std::string response;
+	char buffer[4096];
+	ssize_t received;
+
+	while ((received = recv(client, buffer, sizeof(buffer), 0)) > 0) {
+		response.append(buffer, received);
+	}
+
+	close(client);
+
+	size_t body = response.find("\r\n\r\n");
+
+	if (response.compare(0, 15, "HTTP/1.0 200 OK") != 0 || body == std::string::npos) {
+		return "";
+	}
+
+	if (response.find("Content-Type: text/plain; version=0.0.4\r\n") > body) {
+		return "";
+	}
+
+	return response.substr(body + 4);
+}
+
+// scrapes once while the server answers on its own thread
+static std::string scrapeFrom(Server *server, const MetricsSnapshot *snapshot) {
+	std::thread serving([&]() {
+		server->serve(snapshot);
+	});
+
+	std::string body = scrape(server->port);
+	serving.join();
+
+	return body;
+}
+
+static bool validName(const std::string &name) {
+	if (name.empty() || isdigit((unsigned char)name[0])) {
+		return false;
+	}
+
+	for (char character : name) {
+		if (!isalnum((unsigned char)character) && character != '_' && character != ':') {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+struct Family {
+	std::string type;
+	bool help = false;
+	bool samples = false;
+
+	// histogram state
+	double lastBound = -1;
+	double lastBucket = -1;
+	double infinity = -1;
+	double count = -1;
+	int buckets = 0;
+};
+
+// the metric family of a sample, the name itself or a histogram series stripped of its suffix
+static std::string familyOf(const std::string &name, const std::map<std::string, Family> &families) {
+	for (const char *suffix : { "_bucket", "_sum", "_count" }) {
+		size_t length = strlen(suffix);
+
+		if (name.size() > length && name.compare(name.size() - length, length, suffix) == 0) {
+			std::string base = name.substr(0, name.size() - length);
+			auto family = families.find(base);
+
+			if (family != families.end() && family->second.type == "histogram") {
+				return base;
+			}
+		}
+	}
+
+	return name;
+}
+
+// checks the text format line by line, the parts the station writes and a scraper relies on
+static void validate(const char *name, const std::string &body) {
+	expect(!body.empty(), name, "no response");
+	expect(body.empty() || body.back() == '\n', name, "body does not end with a line feed");
+
+	std::map<std::string, Family> families;
+	std::string previous;
+	std::set<std::string> series;
+
+	size_t start = 0;
+	int lineNumber = 0;
+
+	while (start < body.size()) {
+		size_t end = body.find('\n', start);
+
+		if (end == std::string::npos) {
+			end = body.size();
+		}
+
+		std::string line = body.substr(start, end - start);
+		start = end + 1;
+		lineNumber++;
+
+		std::string where = "line " + std::to_string(lineNumber) + ": " + line;
+
+		if (line.compare(0, 7, "# HELP ") == 0) {
+			std::string metric = line.substr(7, line.find(' ', 7) - 7);
+			Family *family = &families[metric];
+
+			expect(validName(metric), name, "invalid name in " + where);
+			expect(!family->help && !family->samples, name, "second HELP or HELP after samples in " + where);
+			expect(line.size() > 8 + metric.size(), name, "empty HELP in " + where);
+
+			family->help = true;
+			previous = metric;
+
+			continue;
+		}
+
+		if (line.compare(0, 7, "# TYPE ") == 0) {
+			size_t space = line.find(' ', 7);
+			std::string metric = line.substr(7, space - 7);
+			std::string type = space == std::string::npos ? "" : line.substr(space + 1);
+			Family *family = &families[metric];
+
+			expect(metric == previous, name, "TYPE without the HELP right before it in " + where);
+			expect(family->type.empty() && !family->samples, name, "second TYPE or TYPE after samples in " + where);
+			expect(type == "counter" || type == "gauge" || type == "histogram", name, "unknown type in " + where);
+			expect(type != "counter" || (metric.size() > 6 && metric.compare(metric.size() - 6, 6, "_total") == 0), name, "counter without _total in " + where);
+
+			family->type = type;
+			previous = "";
+
+			continue;
+		}
+
+		expect(line.empty() || line[0] != '#', name, "unknown comment in " + where);
+
+		// sample: name, optional labels, a value
+		size_t nameEnd = line.find_first_of("{ ");
+		std::string metric = line.substr(0, nameEnd);
+		std::string labels;
+		size_t valueStart = nameEnd;
+
+		if (nameEnd != std::string::npos && line[nameEnd] == '{') {
+			size_t close = line.find("} ", nameEnd);
+
+			expect(close != std::string::npos, name, "unterminated labels in " + where);
+
+			if (close == std::string::npos) {
+				continue;
+			}
+
+			labels = line.substr(nameEnd + 1, close - nameEnd - 1);
+			valueStart = close + 1;
+		}
+
+		expect(valueStart != std::string::npos && valueStart + 1 < line.size(), name, "sample without a value in " + where);
+
+		if (valueStart == std::string::npos || valueStart + 1 >= line.size()) {
+			continue;
+		}
+
+		std::string text = line.substr(valueStart + 1);
+		char *parsed = NULL;
+		double value = strtod(text.c_str(), &parsed);
+
+		expect(*parsed == 0 && parsed != text.c_str(), name, "value is not a number in " + where);
+		expect(series.insert(metric + "{" + labels + "}").second, name, "repeated series in " + where);
+
+		std::string base = familyOf(metric, families);
+		auto found = families.find(base);
+
+		expect(found != families.end() && found->second.help && !found->second.type.empty(), name, "sample before its HELP and TYPE in " + where);
+
+		if (found == families.end()) {
+			continue;
+		}
+
+		Family *family = &found->second;
+		family->samples = true;
+
+		expect(family->type != "counter" || value >= 0, name, "negative counter in " + where);
+
+		if (family->type != "histogram") {
+			continue;
+		}
+
+		if (metric == base + "_bucket") {
+			expect(labels.compare(0, 4, "le=\"") == 0 && labels.back() == '"', name, "bucket without le in " + where);
+
+			std::string bound = labels.substr(4, labels.size() - 5);
+			double limit = bound == "+Inf" ? INFINITY : strtod(bound.c_str(), NULL);
+
+			expect(limit > family->lastBound, name, "bucket bounds not increasing in " + where);
+			expect(value >= family->lastBucket, name, "buckets not cumulative in " + where);
+			expect(family->infinity < 0, name, "bucket after +Inf in " + where);
+
+			family->lastBound = limit;
+			family->lastBucket = value;
+			family->buckets++;
+
+			if (bound == "+Inf") {
+				family->infinity = value;
+			}
+		} else if (metric == base + "_count") {
+			expect(family->infinity >= 0, name, "_count before the +Inf bucket in " + where);
+
+			family->count = value;
+		}
+	}
+
+	for (const auto &[metric, family] : families) {
+		expect(family.help && !family.type.empty(), name, metric + " lacks HELP or TYPE");
+		expect(family.samples, name, metric + " has no samples");
+
+		if (family.type == "histogram") {
+			expect(family.buckets == HISTOGRAM_BUCKETS, name, metric + " bucket count");
+			expect(family.infinity >= 0 && family.infinity == family.count, name, metric + " +Inf bucket differs from _count");
+		}
+	}
+}
+
+static int check() {
+	Server server;
+
+	if (!server.begin(0)) {
+		return 1;
+	}
+
+	MetricsSnapshot empty = {};
+	MetricsSnapshot typical = typicalSnapshot();
+	MetricsSnapshot largest = largestSnapshot();
+
+	struct {
+		const char *name;
+		const MetricsSnapshot *snapshot;
+	} cases[] = {
+		{ "empty", &empty },
+		{ "typical", &typical },
+		{ "largest", &largest }
+	};
+
+	for (const auto &scrapeCase : cases) {
+		std::string body = scrapeFrom(&server, scrapeCase.snapshot);
+
+		validate(scrapeCase.name, body);
+		expect(!server.truncated(), scrapeCase.name, "body cut off at METRICS_BODY_LIMIT");
+
+		printf("%-8s %5zu bytes of %d\n", scrapeCase.name, body.size(), METRICS_BODY_LIMIT);
+	}
+
+	// the values come through, a sum in seconds and counts as they are
+	std::string body = scrapeFrom(&server, &typical);
+	uint32_t renderCount = 0;
+
+	for (uint32_t bucket : typical.renderTime.buckets) {
+		renderCount += bucket;
+	}
+
+	expect(body.find("tag_scans_decoded_total 48213\n") != std::string::npos, "typical", "counter value");
+	expect(body.find("tag_clock_offset_microseconds -1734460221000\n") != std::string::npos, "typical", "negative 64 bit gauge");
+	expect(body.find("tag_heap_free_bytes{capability=\"dma\"} 171200\n") != std::string::npos, "typical", "labelled gauge");
+	expect(body.find("tag_render_seconds_count " + std::to_string(renderCount) + "\n") != std::string::npos, "typical", "histogram count");
+
+	// a sum past 2^32 microseconds, 71 minutes, does not wrap
+	MetricsSnapshot longRun = typical;
+	longRun.renderTime.sum = 5000000000ull;
+
+	body = scrapeFrom(&server, &longRun);
+	expect(body.find("tag_render_seconds_sum 5000\n") != std::string::npos, "long run", "histogram sum wrapped");
+
+	// le bounds are inclusive, an observation of exactly 2^n lands in the bucket labelled 2^n
+	for (uint8_t bucket = 0; bucket < HISTOGRAM_BUCKETS - 1; bucket++) {
+		expect(histogramBucket(1u << bucket) == bucket, "buckets", "2^n outside the bucket labelled 2^n");
+		expect(histogramBucket((1u << bucket) + 1) == bucket + 1, "buckets", "2^n + 1 inside the bucket labelled 2^n");
+	}
+
+	expect(histogramBucket(0) == 0 && histogramBucket(UINT32_MAX) == HISTOGRAM_BUCKETS - 1, "buckets", "range ends");
+
+	return checkResult();
+}
+
+static int benchmark(int count) {
+	Server server;
+
+	if (!server.begin(0)) {
+		return 1;
+	}
+
+	MetricsSnapshot snapshot = typicalSnapshot();
+
+	std::vector<double> formats;
+	std::vector<double> scrapes;
+	size_t bytes = 0;
+
+	std::thread serving([&]() {
+		for (int index = 0; index < count; index++) {
+			server.serve(&snapshot);
+			formats.push_back(server.formatTime);
+		}
+	});
+
+	for (int index = 0; index < count; index++) {
+		auto start = std::chrono::steady_clock::now();
+		std::string body = scrape(server.port);
+		auto end = std::chrono::steady_clock::now();
+
+		scrapes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+		bytes = body.size();
+	}
+
+	serving.join();
+
+	std::sort(formats.begin(), formats.end());
+	std::sort(scrapes.begin(), scrapes.end());
+
+	auto percentile = [](const std::vector<double> &values, double share) {
+		return values[std::min(values.size() - 1, (size_t)(values.size() * share))];
+	};
+
+	printf("%d scrapes, %zu byte body\n", count, bytes);
+	printf("format   p50 %8.2f us  p99 %8.2f us\n", percentile(formats, 0.5), percentile(formats, 0.99));
+	printf("scrape   p50 %8.2f us  p99 %8.2f us\n", percentile(scrapes, 0.5), percentile(scrapes, 0.99));
+	printf("format share of a scrape %.1f %%\n", 100 * percentile(formats, 0.5) / percentile(scrapes, 0.5));
+
+	return 0;
+}
+
+static int serve(uint16_t port) {
+	Server server;
+
+	if (!server.begin(port)) {
+		return 1;
+	}
+
+	MetricsSnapshot snapshot = typicalSnapshot();
+	printf("serving on port %u\n", server.port);
+
+	while (true) {
+		server.serve(&snapshot);
+	}
+}
+
+int main(int count, char **arguments) {
+	std::string mode = count > 1 ? arguments[1] : "";
+
+	if (mode == "check" && count == 2) {
+		return check();
+	}
+
+	if (mode == "benchmark" && count <= 3) {
+		return benchmark(count == 3 ? atoi(arguments[2]) : 2000);
+	}
+
+	if (mode == "serve" && count <= 3) {
+		return serve(count == 3 ? atoi(arguments[2]) : 9100);
+	}
+
+	fprintf(stderr, "usage: %s check | benchmark [COUNT] | serve [PORT]\n", arguments[0]);
+
+	return 1;
+}
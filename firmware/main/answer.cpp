@@ -0,0 +1,175 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// tag metadata server protocol and the cache of its answers
+//
+// the lookup task uses both under its lock, lookup/index.cpp serves the protocol and replays
+// scans through the same cache on the host
+//
+// requests are pipelined over one connection, answers may arrive in any order
+//
+//   request:  id (2) | tag length (1) | tag
+//   response: id (2) | flags (1) | ttl seconds (2) | destination length (1) | destination
+//
+// all integers big endian
+
+#define LOOKUP_PORT 49235
+
+#define LOOKUP_REQUEST_HEADER_SIZE 3
+#define LOOKUP_RESPONSE_HEADER_SIZE 6
+
+// requests on their way at once, and how long one waits for its answer
+#define LOOKUP_INFLIGHT_LIMIT 16
+#define LOOKUP_TIMEOUT_MS 2000
+
+#define LOOKUP_CACHE_SIZE 64
+#define LOOKUP_TTL_MS (5 * 60 * 1000)
+
+// longest destination the server sends, longer ones break the connection
+#define LOOKUP_DESTINATION_LIMIT 24
+
+// longer scans, such as 2D codes, are not looked up
+#define LOOKUP_TAG_LIMIT 32
+
+#define LOOKUP_FLAG_HOLD (1 << 0)
+
+struct LookupResult {
+	char tag[LOOKUP_TAG_LIMIT];
+
+	uint8_t flags;
+	char destination[LOOKUP_DESTINATION_LIMIT + 1];
+};
+
+struct LookupCacheEntry {
+	LookupResult result;
+
+	uint32_t hash;
+	int64_t expires;
+
+	// least recently used list, indices into the entries
+	int16_t previous;
+	int16_t next;
+};
+
+static inline uint32_t lookupHash(const char *tag) {
+	// fnv-1a
+	uint32_t hash = 2166136261u;
+
+	while (*tag) {
+		hash = (hash ^ (uint8_t)*tag++) * 16777619u;
+	}
+
+	return hash;
+}
+
+// fills flags and destination from a complete response, returns the request id
+static inline uint16_t lookupDecode(const uint8_t *response, LookupResult *result, uint16_t *ttl) {
+	result->flags = response[2];
+
+	uint8_t length = response[5] < LOOKUP_DESTINATION_LIMIT ? response[5] : LOOKUP_DESTINATION_LIMIT;
+	memcpy(result->destination, response + LOOKUP_RESPONSE_HEADER_SIZE, length);
+	result->destination[length] = '\0';
+
+	*ttl = (response[3] << 8) | response[4];
+
+	return (response[0] << 8) | response[1];
+}
+
+// fixed size cache of recent answers, evicts the least recently used entry
+//
+// not locked, the owner serializes access
+class LookupCache {
+	public:
+		bool get(const char *tag, int64_t now, LookupResult *result);
+		void put(const LookupResult *result, int64_t expires);
+
+	private:
+		LookupCacheEntry entries[LOOKUP_CACHE_SIZE];
+		uint8_t count = 0;
+
+		int16_t head = -1;
+		int16_t tail = -1;
+
+		int16_t find(const char *tag, uint32_t hash);
+		void unlink(int16_t index);
+		void pushFront(int16_t index);
+};
+
+int16_t LookupCache::find(const char *tag, uint32_t hash) {
+	for (int16_t index = 0; index < this->count; index++) {
+		if (this->entries[index].hash == hash && strcmp(this->entries[index].result.tag, tag) == 0) {
+			return index;
+		}
+	}
+
+	return -1;
+}
+
+void LookupCache::unlink(int16_t index) {
+	LookupCacheEntry *entry = &this->entries[index];
+
+	if (entry->previous >= 0) {
+		this->entries[entry->previous].next = entry->next;
+	} else {
+		this->head = entry->next;
+	}
+
+	if (entry->next >= 0) {
+		this->entries[entry->next].previous = entry->previous;
+	} else {
+		this->tail = entry->previous;
+	}
+}
+
+void LookupCache::pushFront(int16_t index) {
+	LookupCacheEntry *entry = &this->entries[index];
+
+	entry->previous = -1;
+	entry->next = this->head;
+
+	if (this->head >= 0) {
+		this->entries[this->head].previous = index;
+	}
+
+	this->head = index;
+
+	if (this->tail < 0) {
+		this->tail = index;
+	}
+}
+
+bool LookupCache::get(const char *tag, int64_t now, LookupResult *result) {
+	int16_t index = this->find(tag, lookupHash(tag));
+	bool found = index >= 0 && this->entries[index].expires > now;
+
+	if (found) {
+		*result = this->entries[index].result;
+
+		this->unlink(index);
+		this->pushFront(index);
+	}
+
+	return found;
+}
+
+void LookupCache::put(const LookupResult *result, int64_t expires) {
+	uint32_t hash = lookupHash(result->tag);
+	int16_t index = this->find(result->tag, hash);
+
+	if (index >= 0) {
+		this->unlink(index);
+	} else if (this->count < LOOKUP_CACHE_SIZE) {
+		index = this->count++;
+	} else {
+		index = this->tail;
+		this->unlink(index);
+	}
+
+	this->entries[index].result = *result;
+	this->entries[index].hash = hash;
+	this->entries[index].expires = expires;
+
+	this->pushFront(index);
+}
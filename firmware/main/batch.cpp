@@ -0,0 +1,309 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// scan batches as sent to the collector
+//
+// the collector side decodes with the same code, batch/index.cpp checks it against
+// truncated and hostile input and measures it on tag sequences
+//
+// every batch decodes on its own, each tag is compressed against the previous tag of the batch
+//
+//   batch:  magic (1) | record count (2, little endian) | base time us (varint) | records
+//   record: time since previous record us (varint) | header (varint) | body
+//
+//   header bit 0 clear: header >> 1 characters are shared with the previous tag
+//     body: suffix length (varint) | suffix
+//   header bit 0 set: the trailing number of the previous tag changes by zigzag(header >> 1)
+//     body: empty
+
+// a batch is sent as soon as it hits any of these limits
+#define BATCH_SIZE_LIMIT 512
+#define BATCH_RECORD_LIMIT 64
+#define BATCH_LATENCY_MS 50
+
+// scans waiting for the uplink to batch them, further scans are dropped
+#define UPLINK_QUEUE_LENGTH 32
+
+// low priority scans leave the second half of the queue to the others, high priority scans
+// close their batch at once
+#define UPLINK_LOW_PRIORITY_LIMIT (UPLINK_QUEUE_LENGTH / 2)
+
+#define BATCH_MAGIC 0xb5
+#define BATCH_HEADER_SIZE 3
+
+#define BATCH_TAG_LIMIT 256
+
+// longest trailing number handled by the delta form
+#define BATCH_NUMBER_DIGITS 18
+
+static inline size_t batchPutVarint(uint8_t *target, uint64_t value) {
+	size_t length = 0;
+
+	while (value >= 0x80) {
+		target[length++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+
+	target[length++] = (uint8_t)value;
+
+	return length;
+}
+
+static inline bool batchGetVarint(const uint8_t *data, size_t length, size_t *offset, uint64_t *value) {
+	uint64_t result = 0;
+
+	for (uint8_t shift = 0; shift < 64 && *offset < length; shift += 7) {
+		uint8_t byte = data[(*offset)++];
+		result |= (uint64_t)(byte & 0x7f) << shift;
+
+		if (!(byte & 0x80)) {
+			*value = result;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static inline uint64_t zigzagEncode(int64_t value) {
+	return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t zigzagDecode(uint64_t value) {
+	return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+// length of the run of digits at the end of a tag
+static inline uint16_t trailingDigits(const char *tag, uint16_t length) {
+	uint16_t digits = 0;
+
+	while (digits < length && digits < BATCH_NUMBER_DIGITS) {
+		char character = tag[length - digits - 1];
+
+		if (character < '0' || character > '9') {
+			break;
+		}
+
+		digits++;
+	}
+
+	return digits;
+}
+
+static inline uint64_t parseDigits(const char *digits, uint16_t count) {
+	uint64_t value = 0;
+
+	for (uint16_t index = 0; index < count; index++) {
+		value = value * 10 + (digits[index] - '0');
+	}
+
+	return value;
+}
+
+// writes value zero padded to count digits, false if it does not fit
+static inline bool formatDigits(char *target, uint16_t count, uint64_t value) {
+	for (uint16_t index = count; index > 0; index--) {
+		target[index - 1] = '0' + value % 10;
+		value /= 10;
+	}
+
+	return value == 0;
+}
+
+class BatchEncoder {
+	public:
+		uint16_t count = 0;
+		size_t length = 0;
+
+		void begin(uint8_t *buffer, size_t capacity, uint64_t time);
+
+		// false if the record does not fit, the batch is left unchanged
+		bool append(const char *tag, uint16_t tagLength, uint64_t time);
+
+		// completes the header, returns the encoded size
+		size_t finish();
+
+	private:
+		uint8_t *buffer = NULL;
+		size_t capacity = 0;
+
+		char previous[BATCH_TAG_LIMIT];
+		uint16_t previousLength = 0;
+		uint64_t previousTime = 0;
+};
+
+void BatchEncoder::begin(uint8_t *buffer, size_t capacity, uint64_t time) {
+	this->buffer = buffer;
+	this->capacity = capacity;
+
+	this->count = 0;
+	this->previousLength = 0;
+	this->previousTime = time;
+
+	buffer[0] = BATCH_MAGIC;
+	this->length = BATCH_HEADER_SIZE;
+	this->length += batchPutVarint(buffer + this->length, time);
+}
+
+bool BatchEncoder::append(const char *tag, uint16_t tagLength, uint64_t time) {
+	if (tagLength > BATCH_TAG_LIMIT || this->count == UINT16_MAX) {
+		return false;
+	}
+
+	// worst case: two varints, a length and the full tag
+	uint8_t record[10 + 10 + 3 + BATCH_TAG_LIMIT];
+	size_t recordLength = batchPutVarint(record, time >= this->previousTime ? time - this->previousTime : 0);
+
+	bool encoded = false;
+	uint16_t digits = trailingDigits(this->previous, this->previousLength);
+
+	// sequential serials: same length and stem, only the trailing number moved
+	if (
+		digits > 0 &&
+		tagLength == this->previousLength &&
+		memcmp(tag, this->previous, tagLength - digits) == 0 &&
+		trailingDigits(tag, tagLength) >= digits
+	) {
+		int64_t delta =
+			(int64_t)parseDigits(tag + tagLength - digits, digits) -
+			(int64_t)parseDigits(this->previous + tagLength - digits, digits);
+
+		recordLength += batchPutVarint(record + recordLength, (zigzagEncode(delta) << 1) | 1);
+		encoded = true;
+	}
+
+	if (!encoded) {
+		uint16_t shared = 0;
+
+		while (shared < tagLength && shared < this->previousLength && tag[shared] == this->previous[shared]) {
+			shared++;
+		}
+
+		recordLength += batchPutVarint(record + recordLength, (uint64_t)shared << 1);
+		recordLength += batchPutVarint(record + recordLength, tagLength - shared);
+
+		memcpy(record + recordLength, tag + shared, tagLength - shared);
+		recordLength += tagLength - shared;
+	}
+
+	if (this->length + recordLength > this->capacity) {
+		return false;
+	}
+
+	memcpy(this->buffer + this->length, record, recordLength);
+	this->length += recordLength;
+	this->count++;
+
+	memcpy(this->previous, tag, tagLength);
+	this->previousLength = tagLength;
+
+	if (time >= this->previousTime) {
+		this->previousTime = time;
+	}
+
+	return true;
+}
+
+size_t BatchEncoder::finish() {
+	this->buffer[1] = this->count & 0xff;
+	this->buffer[2] = this->count >> 8;
+
+	return this->length;
+}
+
+class BatchDecoder {
+	public:
+		// current record, valid after next returned true
+		char tag[BATCH_TAG_LIMIT];
+		uint16_t tagLength = 0;
+		uint64_t time = 0;
+
+		uint16_t count = 0;
+
+		bool open(const uint8_t *data, size_t length);
+
+		// false at the end of the batch or on malformed input
+		bool next();
+
+	private:
+		const uint8_t *data = NULL;
+		size_t length = 0;
+		size_t offset = 0;
+
+		uint16_t remaining = 0;
+};
+
+bool BatchDecoder::open(const uint8_t *data, size_t length) {
+	this->data = data;
+	this->length = length;
+	this->tagLength = 0;
+
+	if (length < BATCH_HEADER_SIZE || data[0] != BATCH_MAGIC) {
+		return false;
+	}
+
+	this->count = data[1] | (data[2] << 8);
+	this->remaining = this->count;
+	this->offset = BATCH_HEADER_SIZE;
+
+	return batchGetVarint(data, length, &this->offset, &this->time);
+}
+
+bool BatchDecoder::next() {
+	if (this->remaining == 0) {
+		return false;
+	}
+
+	uint64_t elapsed;
+	uint64_t header;
+
+	if (
+		!batchGetVarint(this->data, this->length, &this->offset, &elapsed) ||
+		!batchGetVarint(this->data, this->length, &this->offset, &header)
+	) {
+		return false;
+	}
+
+	if (header & 1) {
+		uint16_t digits = trailingDigits(this->tag, this->tagLength);
+
+		if (digits == 0) {
+			return false;
+		}
+
+		char *number = this->tag + this->tagLength - digits;
+		int64_t value = (int64_t)parseDigits(number, digits) + zigzagDecode(header >> 1);
+
+		if (value < 0 || !formatDigits(number, digits, (uint64_t)value)) {
+			return false;
+		}
+	} else {
+		uint64_t shared = header >> 1;
+		uint64_t suffix;
+
+		// shared is at most the previous length and the offset at most the batch length, so
+		// the differences cannot wrap where a sum with a hostile suffix would
+		if (
+			shared > this->tagLength ||
+			!batchGetVarint(this->data, this->length, &this->offset, &suffix) ||
+			suffix > BATCH_TAG_LIMIT - shared ||
+			suffix > this->length - this->offset
+		) {
+			return false;
+		}
+
+		memcpy(this->tag + shared, this->data + this->offset, suffix);
+
+		this->offset += suffix;
+		this->tagLength = shared + suffix;
+	}
+
+	this->time += elapsed;
+	this->remaining--;
+
+	return true;
+}
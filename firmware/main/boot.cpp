@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdint.h>
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/event_groups.h"
+	#include "esp_timer.h"
+	#include "esp_log.h"
+}
+
+// subsystems signal readiness through these bits
+#define BOOT_USB_READY (1 << 0)
+#define BOOT_DISPLAY_READY (1 << 1)
+#define BOOT_NETWORK_READY (1 << 2)
+
+// the timeline is logged once the station is usable, the usb device may never be plugged in
+#define BOOT_REPORT_READY (BOOT_DISPLAY_READY | BOOT_NETWORK_READY)
+
+// or after this long without display or network
+#define BOOT_REPORT_TIMEOUT_MS 15000
+
+#define BOOT_STAGE_LIMIT 16
+
+struct BootStage {
+	const char *name;
+	int64_t time;
+};
+
+class Boot {
+	public:
+		EventGroupHandle_t ready = NULL;
+
+		void begin();
+
+		// records a timeline entry and optionally raises ready bits
+		void mark(const char *name, EventBits_t bits = 0);
+
+		bool isReady(EventBits_t bits);
+
+		// stages marked since the last report
+		bool hasUnreported();
+
+		// logs the stages marked since the last report, later reports append to the timeline
+		void report();
+
+	private:
+		StaticEventGroup_t readyControl;
+
+		BootStage stages[BOOT_STAGE_LIMIT];
+		volatile uint8_t stageCount = 0;
+
+		uint8_t reportedCount = 0;
+		int64_t reportedTime = 0;
+
+		portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+// shared instance declaration
+extern Boot boot;
+
+// shared instance definition
+Boot boot;
+
+void Boot::begin() {
+	this->ready = xEventGroupCreateStatic(&this->readyControl);
+
+	this->mark("main");
+}
+
+void Boot::mark(const char *name, EventBits_t bits) {
+	int64_t time = esp_timer_get_time();
+
+	// stages are marked from several tasks at once
+	taskENTER_CRITICAL(&this->lock);
+
+	if (this->stageCount < BOOT_STAGE_LIMIT) {
+		this->stages[this->stageCount].name = name;
+		this->stages[this->stageCount].time = time;
+
+		this->stageCount++;
+	}
+
+	taskEXIT_CRITICAL(&this->lock);
+
+	ESP_LOGI("BOOT", "%s at %lld us", name, time);
+
+	if (bits && this->ready) {
+		xEventGroupSetBits(this->ready, bits);
+	}
+}
+
+bool Boot::isReady(EventBits_t bits) {
+	return (xEventGroupGetBits(this->ready) & bits) == bits;
+}
+
+bool Boot::hasUnreported() {
+	return this->reportedCount < this->stageCount;
+}
+
+void Boot::report() {
+	ESP_LOGI("BOOT", "timeline%s", this->reportedCount > 0 ? ", continued" : "");
+
+	int64_t previous = this->reportedTime;
+	uint8_t count = this->stageCount;
+
+	for (uint8_t index = this->reportedCount; index < count; index++) {
+		ESP_LOGI(
+			"BOOT",
+			"%8lld us  +%7lld us  %s",
+			this->stages[index].time,
+			this->stages[index].time - previous,
+			this->stages[index].name
+		);
+
+		previous = this->stages[index].time;
+	}
+
+	this->reportedCount = count;
+	this->reportedTime = previous;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// tag families, classified on the station right after a scan completes
+//
+// the rules compile into a deterministic automaton stored as flat arrays: characters map to
+// a few classes, every state has one transition per class, so a scan is classified in one
+// pass with a table load per character
+
+typedef enum {
+	TAG_PRIORITY_LOW = 0,
+	TAG_PRIORITY_NORMAL,
+	TAG_PRIORITY_HIGH
+} tag_priority_t;
+
+// set in a result once no later character can change it
+#define TAG_RESULT_FINAL 0x80
+
+// family index + 1, 0 if no rule matches
+#define TAG_RESULT_FAMILY 0x7f
+
+struct TagFamily {
+	const char *name;
+
+	// RGB565, as used by the display
+	uint16_t color;
+	tag_priority_t priority;
+};
+
+struct TagTable {
+	const TagFamily *families;
+	uint8_t familyCount;
+
+	// character to class
+	const uint8_t *classes;
+	uint8_t classCount;
+
+	// next state per state and class, state 0 is the start
+	const uint16_t *transitions;
+
+	// per state: result of a tag that ends here, TAG_RESULT_FINAL
+	const uint8_t *results;
+	uint16_t stateCount;
+};
+
+// family index + 1, 0 for tags no rule matches
+static inline uint8_t classifyTag(const TagTable *table, const char *tag, uint16_t length) {
+	uint16_t state = 0;
+
+	for (uint16_t index = 0; index < length; index++) {
+		if (table->results[state] & TAG_RESULT_FINAL) {
+			break;
+		}
+
+		state = table->transitions[state * table->classCount + table->classes[(uint8_t)tag[index]]];
+	}
+
+	return table->results[state] & TAG_RESULT_FAMILY;
+}
+
+static inline const TagFamily *tagFamily(const TagTable *table, uint8_t family) {
+	if (family == 0 || family > table->familyCount) {
+		return NULL;
+	}
+
+	return &table->families[family - 1];
+}
+
+// uplink priority of a classified tag, normal for tags no rule matches
+static inline tag_priority_t tagPriority(const TagTable *table, uint8_t family) {
+	const TagFamily *result = tagFamily(table, family);
+
+	return result ? result->priority : TAG_PRIORITY_NORMAL;
+}
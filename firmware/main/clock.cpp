@@ -0,0 +1,170 @@
+#pragma once
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/task.h"
+	#include "esp_log.h"
+	#include "esp_timer.h"
+}
+
+#include "boot.cpp"
+#include "memory.cpp"
+#include "network.cpp"
+#include "timebase.cpp"
+
+// time exchange with the collector over UDP, scan times become collector time, the wire
+// format is in timebase.cpp
+
+#define CLOCK_HOST "192.168.31.137"
+
+#define CLOCK_STACK_SIZE 4096
+
+// answers arriving later are dropped, their delay would be rejected anyway
+#define CLOCK_TIMEOUT_MS 500
+
+// polled quickly until the estimator has a full window, slowly after that
+#define CLOCK_FAST_POLL_MS 1000
+#define CLOCK_POLL_MS 8000
+
+class ClockSync {
+	public:
+		Timebase timebase;
+
+		// written by the sync task only
+		ClockEstimator estimator;
+		uint32_t timeouts = 0;
+
+		// last published offset and drift, for the metrics
+		TimebaseParameters parameters = {};
+
+		void begin();
+		void run();
+
+	private:
+		uint16_t sequence = 0;
+
+		bool exchange(int connection);
+};
+
+// shared instance declaration
+extern ClockSync clockSync;
+
+// shared instance definition
+ClockSync clockSync;
+
+// collector time in microseconds, time since boot until the first sync
+static inline uint64_t syncedMicroseconds() {
+	return clockSync.timebase.convert(esp_timer_get_time());
+}
+
+TASK_STORAGE(clockSync, CLOCK_STACK_SIZE)
+
+static void clockSyncTask(void *args) {
+	clockSync.run();
+}
+
+void ClockSync::begin() {
+	memory.createTask(
+		clockSyncTask,
+		"clock", "clock",
+		CLOCK_STACK_SIZE,
+		NULL,
+		2, tskNO_AFFINITY,
+		TASK_STORAGE_OF(clockSync)
+	);
+}
+
+bool ClockSync::exchange(int connection) {
+	uint8_t request[CLOCK_REQUEST_SIZE];
+	uint16_t sequence = ++this->sequence;
+
+	int64_t t1 = esp_timer_get_time();
+
+	request[0] = CLOCK_MAGIC;
+	request[1] = sequence >> 8;
+	request[2] = sequence & 0xff;
+	clockPut(request + 3, t1);
+
+	if (send(connection, request, sizeof(request), 0) != sizeof(request)) {
+		return false;
+	}
+
+	uint8_t response[CLOCK_RESPONSE_SIZE];
+
+	// late answers to earlier requests are skipped
+	while (true) {
+		ssize_t length = recv(connection, response, sizeof(response), 0);
+		int64_t t4 = esp_timer_get_time();
+
+		if (length < 0) {
+			this->timeouts++;
+
+			return false;
+		}
+
+		if (
+			length != CLOCK_RESPONSE_SIZE ||
+			response[0] != CLOCK_MAGIC ||
+			((response[1] << 8) | response[2]) != sequence ||
+			clockGet(response + 3) != t1
+		) {
+			continue;
+		}
+
+		TimebaseParameters parameters;
+
+		if (this->estimator.add(t1, clockGet(response + 11), clockGet(response + 19), t4, &parameters)) {
+			this->timebase.publish(&parameters);
+			this->parameters = parameters;
+		}
+
+		return true;
+	}
+}
+
+void ClockSync::run() {
+	xEventGroupWaitBits(boot.ready, BOOT_NETWORK_READY, pdFALSE, pdTRUE, portMAX_DELAY);
+
+	int connection = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(CLOCK_PORT);
+	inet_pton(AF_INET, CLOCK_HOST, &address.sin_addr.s_addr);
+
+	// a connected socket only receives from the server
+	if (connection < 0 || connect(connection, (struct sockaddr *)&address, sizeof(address)) != 0) {
+		ESP_LOGE("CLOCK", "unable to create socket: errno %d", errno);
+
+		memory.retire();
+		vTaskDelete(NULL);
+	}
+
+	struct timeval timeout = { 0, CLOCK_TIMEOUT_MS * 1000 };
+	setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+	bool reported = false;
+
+	while (true) {
+		if (network.ready) {
+			this->exchange(connection);
+		}
+
+		if (!reported && this->timebase.synced()) {
+			ESP_LOGI("CLOCK", "synced, offset %lld us, delay %lld us", this->parameters.offset, this->estimator.delay);
+
+			reported = true;
+		}
+
+		uint32_t accepted = this->estimator.samples - this->estimator.rejected;
+
+		vTaskDelay(pdMS_TO_TICKS(accepted < CLOCK_DELAY_WINDOW ? CLOCK_FAST_POLL_MS : CLOCK_POLL_MS));
+	}
+}
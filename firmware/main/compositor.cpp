@@ -0,0 +1,187 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/param.h>
+
+// dirty region tracking for the panel
+//
+// widgets mark what changed, the display asks for the regions to push once per refresh,
+// overlapping or close regions are merged whenever one transfer is cheaper than two
+
+// dirty regions kept between refreshes, more are merged into the closest one
+#define COMPOSITOR_REGION_LIMIT 16
+
+// fixed cost of one transfer in pixels: window commands, DMA setup and the completion wait
+#define COMPOSITOR_TRANSFER_COST 2048
+
+// rectangle in panel coordinates
+struct Region {
+	uint16_t x;
+	uint16_t y;
+
+	uint16_t width;
+	uint16_t height;
+};
+
+static inline bool regionEmpty(Region region) {
+	return region.width == 0 || region.height == 0;
+}
+
+static inline uint32_t regionArea(Region region) {
+	return (uint32_t)region.width * region.height;
+}
+
+static Region regionUnion(Region a, Region b) {
+	if (regionEmpty(a)) {
+		return b;
+	}
+
+	if (regionEmpty(b)) {
+		return a;
+	}
+
+	uint16_t x = MIN(a.x, b.x);
+	uint16_t y = MIN(a.y, b.y);
+
+	return {
+		x, y,
+		(uint16_t)(MAX(a.x + a.width, b.x + b.width) - x),
+		(uint16_t)(MAX(a.y + a.height, b.y + b.height) - y)
+	};
+}
+
+// empty if the regions do not overlap
+static inline Region regionIntersection(Region a, Region b) {
+	int left = MAX(a.x, b.x);
+	int top = MAX(a.y, b.y);
+	int right = MIN(a.x + a.width, b.x + b.width);
+	int bottom = MIN(a.y + a.height, b.y + b.height);
+
+	if (right <= left || bottom <= top) {
+		return { 0, 0, 0, 0 };
+	}
+
+	return { (uint16_t)left, (uint16_t)top, (uint16_t)(right - left), (uint16_t)(bottom - top) };
+}
+
+class Compositor {
+	public:
+		// area limit keeps merged regions within one frame, interval limits the refresh rate
+		void begin(uint32_t areaLimit, uint32_t interval);
+
+		void invalidate(Region region);
+
+		// regions to push now, none while the refresh interval has not passed
+		//
+		// time is in milliseconds, regions has to hold COMPOSITOR_REGION_LIMIT entries
+		uint8_t collect(Region *regions, uint64_t time);
+
+		bool pending() const {
+			return this->count > 0;
+		}
+
+	private:
+		Region dirty[COMPOSITOR_REGION_LIMIT];
+		uint8_t count = 0;
+
+		uint32_t areaLimit = UINT32_MAX;
+		uint32_t interval = 0;
+		uint64_t lastRefresh = 0;
+		bool refreshed = false;
+
+		// pixels a merge pushes beyond the two regions, minus the saved transfer
+		int64_t mergeCost(Region a, Region b) const {
+			return (int64_t)regionArea(regionUnion(a, b)) - regionArea(a) - regionArea(b) - COMPOSITOR_TRANSFER_COST;
+		}
+
+		void remove(uint8_t index);
+		void merge();
+};
+
+void Compositor::begin(uint32_t areaLimit, uint32_t interval) {
+	this->areaLimit = areaLimit;
+	this->interval = interval;
+
+	this->count = 0;
+	this->refreshed = false;
+}
+
+void Compositor::remove(uint8_t index) {
+	this->dirty[index] = this->dirty[--this->count];
+}
+
+// merges pairs while that saves pixels, cheapest first
+void Compositor::merge() {
+	while (this->count > 1) {
+		int64_t best = 0;
+		uint8_t first = 0;
+		uint8_t second = 0;
+
+		for (uint8_t a = 0; a < this->count; a++) {
+			for (uint8_t b = a + 1; b < this->count; b++) {
+				Region merged = regionUnion(this->dirty[a], this->dirty[b]);
+				int64_t cost = this->mergeCost(this->dirty[a], this->dirty[b]);
+
+				if (cost <= best && regionArea(merged) <= this->areaLimit) {
+					best = cost;
+					first = a;
+					second = b;
+				}
+			}
+		}
+
+		if (first == second) {
+			return;
+		}
+
+		this->dirty[first] = regionUnion(this->dirty[first], this->dirty[second]);
+		this->remove(second);
+	}
+}
+
+void Compositor::invalidate(Region region) {
+	if (regionEmpty(region)) {
+		return;
+	}
+
+	// a full list takes the new region into its cheapest partner, whatever the size
+	if (this->count == COMPOSITOR_REGION_LIMIT) {
+		uint8_t closest = 0;
+
+		for (uint8_t index = 1; index < this->count; index++) {
+			if (this->mergeCost(region, this->dirty[index]) < this->mergeCost(region, this->dirty[closest])) {
+				closest = index;
+			}
+		}
+
+		region = regionUnion(region, this->dirty[closest]);
+		this->remove(closest);
+	}
+
+	this->dirty[this->count++] = region;
+	this->merge();
+}
+
+uint8_t Compositor::collect(Region *regions, uint64_t time) {
+	if (this->count == 0) {
+		return 0;
+	}
+
+	// changes within the interval wait and are pushed together
+	if (this->refreshed && time - this->lastRefresh < this->interval) {
+		return 0;
+	}
+
+	uint8_t count = this->count;
+
+	for (uint8_t index = 0; index < count; index++) {
+		regions[index] = this->dirty[index];
+	}
+
+	this->count = 0;
+	this->lastRefresh = time;
+	this->refreshed = true;
+
+	return count;
+}
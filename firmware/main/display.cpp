@@ -1,16 +1,23 @@
+#pragma once
+
 #include <ratio>
 #include <stdio.h>
 #include <string.h>
+#include <sys/param.h>
 
 extern "C" {
 	#include "freertos/FreeRTOS.h"
 	#include "freertos/task.h"
+	#include "freertos/semphr.h"
 
 	#include "driver/gpio.h"
 
+	#include "esp_attr.h"
+
 	#include "esp_check.h"
 	#include "esp_heap_caps.h"
 	#include "esp_log.h"
+	#include "esp_timer.h"
 
 	#include "esp_lcd_panel_ops.h"
 	#include "esp_lcd_panel_io.h"
@@ -19,6 +26,7 @@ extern "C" {
 	#include "esp_lcd_st7796.h"
 }
 
+#undef TAG
 #define TAG "DISPLAY"
 
 #define PIN_NUM_CLK GPIO_NUM_7
@@ -32,7 +40,44 @@ extern "C" {
 #define LCD_HEIGHT 320
 #define LCD_WIDTH 480
 
+// tallest frame the display pushes at once
+#define FRAME_LINES 128
+
+// the lookup answer is shown below the tallest possible tag
+#define LOOKUP_TOP (FRAME_LINES + 10)
+
+// shortest time between two refreshes, changes in between are pushed together
+#define DISPLAY_REFRESH_MS 30
+
+// longer text is cut off, it would not fit the panel anyway
+#define WIDGET_TEXT_LIMIT 256
+
+#include "memory.cpp"
+#include "metrics.cpp"
+#include "compositor.cpp"
+#include "text.cpp"
 #include "font/mono-40.cpp"
+#include "trace.cpp"
+
+#if STATIC_MEMORY
+	// shared by all frames, frames are rendered one at a time
+	DMA_ATTR __attribute__((aligned(64))) static uint16_t frameArena[LCD_WIDTH * FRAME_LINES];
+#endif
+
+// given once the panel has consumed a frame
+static StaticSemaphore_t frameDoneControl;
+static SemaphoreHandle_t frameDone = NULL;
+
+static bool IRAM_ATTR onFrameDone(
+	esp_lcd_panel_io_handle_t port,
+	esp_lcd_panel_io_event_data_t *event,
+	void *context
+) {
+	BaseType_t woken = pdFALSE;
+	xSemaphoreGiveFromISR(frameDone, &woken);
+
+	return woken == pdTRUE;
+}
 
 typedef struct Frame {
 	const uint16_t x;
@@ -52,107 +97,23 @@ typedef struct Frame {
 	) : x(x), y(y), width(width), height(height), color(color) {}
 } Frame;
 
-static const Glyph *findGlyph(const Font *font, char character) {
-	for (size_t index = 0; index < font->glyphCount; index++) {
-		if (font->glyphs[index].character == character) {
-			return &font->glyphs[index];
-		}
-	}
+// text within a fixed area of the panel, drawn by the compositor
+// widgets are declared with their area and font, the rest is set by setText
+struct TextWidget {
+	Region area;
+	const Font *font;
+	text_align_t align = TEXT_ALIGN_LEFT;
+	uint16_t color = 0;
 
-	return NULL;
-}
+	char text[WIDGET_TEXT_LIMIT + 1] = {};
+	TextLayout layout = {};
 
-static inline uint16_t rgb(uint8_t r, uint8_t g, uint8_t b) {
-	return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
-}
-
-static uint8_t drawCharacter(
-	const Font *font,
-	const Glyph *glyph,
-
-	uint16_t *canvas,
-	int canvasWidth,
-
-	int x,
-	int y,
+	// part of the area covered by the current text
+	Region ink = {};
 
-	uint16_t fg,
-	uint16_t bg
-) {
-	if (glyph == NULL) {
-		for (int row = 0; row < font->height; row++) {
-			for (int column = 0; column < font->height; column++) {
-				canvas[(y + row) * canvasWidth + x + column] = fg;
-			}
-		}
-
-		return font->height;
-	}
-
-	bool state = false;
-	uint8_t row = 0;
-	uint8_t column = 0;
-
-	for (uint8_t segmentIndex = 0; segmentIndex < glyph->segmentCount; segmentIndex++) {
-		for (uint16_t index = 0; index < glyph->segments[segmentIndex]; index++) {
-			canvas[(y + row) * canvasWidth + x + column] = state ? fg : bg;
-
-			column++;
-
-			if (column == glyph->width) {
-				column = 0;
-				row++;
-			}
-		}
-
-		state = !state;
-	}
-
-	return glyph->width;
-}
-
-static uint16_t drawText(
-	const Font *font,
-
-	uint16_t *canvas,
-	int canvasWidth,
-
-	int x,
-	int y,
-	int maxWidth,
-
-	const char *string,
-
-	uint16_t fg,
-	uint16_t bg
-) {
-	uint16_t advance = 0;
-	uint16_t line = 0;
-
-	while (*string) {
-		char character = *string;
-		ESP_LOGI(TAG, "draw %c %d %d", character, x, y);
-
-		const Glyph *glyph = findGlyph(font, character);
-		uint8_t characterWidth = glyph == NULL ? font->height : glyph->width;
-
-		if (characterWidth + advance > maxWidth) {
-			advance = 0;
-			line++;
-		}
-
-		advance += drawCharacter(
-			font, glyph,
-			canvas, canvasWidth,
-			x + advance, y + line * font->height,
-			fg, bg
-		);
-
-		string++;
-	}
-
-	return line * font->height + font->height;
-}
+	// the text changed and has not reached the panel yet
+	bool pending = false;
+};
 
 class Display {
 	public:
@@ -160,6 +121,12 @@ class Display {
 		esp_lcd_panel_handle_t panel = NULL;
 
 		void begin() {
+			frameDone = xSemaphoreCreateBinaryStatic(&frameDoneControl);
+
+#if STATIC_MEMORY
+			memory.account("display", sizeof(frameArena), true);
+#endif
+
 			ESP_LOGI(TAG, "prepare SPI");
 			spi_bus_config_t busConfiguration = {};
 			busConfiguration.mosi_io_num = PIN_NUM_MOSI;
@@ -178,6 +145,7 @@ class Display {
 			portConfiguration.spi_mode = 0;
 			portConfiguration.pclk_hz = 40 * 1000 * 100;
 			portConfiguration.trans_queue_depth = 10;
+			portConfiguration.on_color_trans_done = onFrameDone;
 			portConfiguration.lcd_cmd_bits = 8;
 			portConfiguration.lcd_param_bits = 8;
 
@@ -198,31 +166,142 @@ class Display {
 
 			ESP_LOGI(TAG, "orient panel");
 			ESP_ERROR_CHECK(esp_lcd_panel_swap_xy(panel, true));
+
+			this->compositor.begin(LCD_WIDTH * FRAME_LINES, DISPLAY_REFRESH_MS);
+
+			this->clear(this->background);
+		}
+
+		void presentTag(const char* tag, uint16_t color, text_align_t align = TEXT_ALIGN_LEFT) {
+			this->setText(&this->tag, tag, color, align);
+		}
+
+		// shows a line below the tag, an empty text clears it
+		void presentLookup(const char *text, uint16_t color) {
+			this->setText(&this->lookup, text, color, TEXT_ALIGN_LEFT);
+		}
+
+		// the last lookup text is not on the panel yet, refresh holds it back within the interval
+		bool lookupPending() const {
+			return this->lookup.pending;
+		}
+
+		// pushes what changed since the last refresh, called from the loop that presents
+		void refresh() {
+			Region regions[COMPOSITOR_REGION_LIMIT];
+			uint8_t count = this->compositor.collect(regions, esp_timer_get_time() / 1000);
+
+			// collect hands out every dirty region at once, so all changed widgets go out now
+			if (count > 0) {
+				this->tag.pending = false;
+				this->lookup.pending = false;
+			}
+
+			for (uint8_t index = 0; index < count; index++) {
+				Region region = regions[index];
+
+				// regions merged beyond one frame go out in stripes
+				uint16_t lines = MIN(region.height, LCD_WIDTH * FRAME_LINES / region.width);
+
+				for (uint16_t top = 0; top < region.height; top += lines) {
+					this->push({
+						region.x, (uint16_t)(region.y + top),
+						region.width, (uint16_t)MIN(lines, region.height - top)
+					});
+				}
+			}
 		}
 
-		void presentTag(const char* tag) {
+	private:
+		Compositor compositor;
+
+		TextWidget tag = { { 10, 0, LCD_WIDTH - 20, FRAME_LINES }, &Monospace40 };
+		TextWidget lookup = { { 10, LOOKUP_TOP, LCD_WIDTH - 20, MIN(FRAME_LINES, LCD_HEIGHT - LOOKUP_TOP) }, &Monospace40 };
+
+		const uint16_t background = rgb(0, 0, 0);
+
+		// lays out new text and marks the old and the new text for redraw
+		void setText(TextWidget *widget, const char *text, uint16_t color, text_align_t align) {
+			if (strncmp(widget->text, text, WIDGET_TEXT_LIMIT) == 0 && widget->color == color && widget->align == align) {
+				return;
+			}
+
+			strncpy(widget->text, text, WIDGET_TEXT_LIMIT);
+			widget->text[WIDGET_TEXT_LIMIT] = '\0';
+
+			widget->color = color;
+			widget->align = align;
+
+			layoutText(&widget->layout, widget->font, widget->text, widget->area.width, widget->area.height);
+
+			Region ink = {
+				(uint16_t)(widget->area.x + layoutOffset(&widget->layout, widget->area.width, align)), widget->area.y,
+				widget->layout.width, widget->layout.height
+			};
+
+			this->compositor.invalidate(widget->ink);
+			this->compositor.invalidate(ink);
+
+			// a blank text replacing a blank one has nothing to push
+			widget->pending = widget->pending || !regionEmpty(widget->ink) || !regionEmpty(ink);
+			widget->ink = ink;
+		}
+
+		// draws every widget within the region and sends it to the panel
+		void push(Region region) {
+			TRACE_BEGIN(TRACE_MARK_RENDER);
+			Stopwatch render;
+
 			Frame frame = this->createFrame(
-				0, 0,
-				LCD_WIDTH, Monospace40.height + 10,
-				rgb(0, 0, 0)
+				region.x, region.y,
+				region.width, region.height,
+				this->background
 			);
 
-			this->renderText(
-				&frame,
-				tag,
-				&Monospace40,
+			TextWidget *widgets[] = { &this->tag, &this->lookup };
 
-				10,
-				0,
-				10,
+			for (TextWidget *widget : widgets) {
+				if (regionEmpty(regionIntersection(widget->ink, region))) {
+					continue;
+				}
 
-				rgb(255, 255, 255)
-			);
+				drawLayout(
+					&widget->layout,
+
+					frame.canvas,
+					frame.width,
+					frame.height,
+
+					widget->area.x - frame.x,
+					widget->area.y - frame.y,
+					widget->area.width,
+					widget->align,
+
+					widget->color,
+					frame.color
+				);
+			}
+
+			render.stop(&renderTime);
 
 			this->renderFrame(&frame);
+
+			displayTransfers.add();
+			displayBytes.add(regionArea(region) * sizeof(uint16_t));
+
+			TRACE_END(TRACE_MARK_RENDER);
+		}
+
+		// fills the whole panel in stripes, the panel content is undefined after reset
+		void clear(uint16_t color) {
+			const uint16_t stripe = 20;
+
+			for (uint16_t y = 0; y < LCD_HEIGHT; y += stripe) {
+				Frame frame = this->createFrame(0, y, LCD_WIDTH, MIN(stripe, LCD_HEIGHT - y), color);
+				this->renderFrame(&frame);
+			}
 		}
 
-	private:
 		Frame createFrame(
 			const uint16_t x,
 			const uint16_t y,
@@ -234,12 +313,18 @@ class Display {
 		) {
 			Frame frame(x, y, width, height, color);
 
+#if STATIC_MEMORY
+			ESP_ERROR_CHECK(width * height <= LCD_WIDTH * FRAME_LINES ? ESP_OK : ESP_ERR_INVALID_SIZE);
+
+			frame.canvas = frameArena;
+#else
 			frame.canvas = (uint16_t*)heap_caps_malloc(
 				width * height * sizeof(uint16_t),
 				MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL
 			);
 
 			ESP_ERROR_CHECK(frame.canvas ? ESP_OK : ESP_ERR_NO_MEM);
+#endif
 
 			for (int i = 0; i < width * height; i++) {
 				frame.canvas[i] = color;
@@ -249,47 +334,28 @@ class Display {
 		}
 
 		void renderFrame(Frame *frame) {
+			TRACE_BEGIN(TRACE_MARK_TRANSFER);
+			Stopwatch transfer;
+
 			ESP_ERROR_CHECK(esp_lcd_panel_draw_bitmap(
 				panel,
 
 				frame->x,
 				frame->y,
 
-				frame->width - frame->x,
-				frame->height - frame->y,
+				frame->x + frame->width,
+				frame->y + frame->height,
 
 				frame->canvas
 			));
 
-			heap_caps_free(frame->canvas);
-		}
-
-		uint16_t renderText(
-			const Frame *frame,
-
-			const char* text,
-			const Font *font,
+			// the transfer runs in the background, the canvas stays in use until it is done
+			xSemaphoreTake(frameDone, portMAX_DELAY);
+			transfer.stop(&transferTime);
+			TRACE_END(TRACE_MARK_TRANSFER);
 
-			uint16_t left,
-			uint16_t top,
-			uint16_t right,
-
-			uint16_t color
-		) {
-			return drawText(
-				font,
-
-				frame->canvas,
-				frame->width,
-
-				left,
-				top,
-				frame->width - right,
-
-				text,
-
-				color,
-				frame->color
-			);
+#if !STATIC_MEMORY
+			heap_caps_free(frame->canvas);
+#endif
 		}
 };
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <errno.h>
+#include <string.h>
+#include <sys/param.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/task.h"
+	#include "freertos/queue.h"
+	#include "esp_heap_caps.h"
+	#include "esp_log.h"
+	#include "esp_timer.h"
+}
+
+#include "boot.cpp"
+#include "clock.cpp"
+#include "memory.cpp"
+#include "metrics.cpp"
+#include "network.cpp"
+#include "prometheus.cpp"
+#include "scan.cpp"
+#include "trace.cpp"
+#include "uplink.cpp"
+#include "lookup.cpp"
+
+// plain HTTP metrics endpoint in the prometheus text format, one scrape at a time,
+// with the recorder built in /trace returns the trace dump
+#define EXPORTER_PORT 9100
+
+#define EXPORTER_STACK_SIZE 4096
+
+class Exporter {
+	public:
+		// duration of the last scrape, including formatting
+		uint32_t lastScrape = 0;
+
+		void begin();
+		void run();
+
+	private:
+		MetricsBody metrics;
+
+		void collect(MetricsSnapshot *snapshot);
+		void serve(int client);
+
+#if TRACE_ENABLED
+		void serveTrace(int client);
+#endif
+};
+
+// shared instance declaration
+extern Exporter exporter;
+
+// shared instance definition
+Exporter exporter;
+
+TASK_STORAGE(exporter, EXPORTER_STACK_SIZE)
+
+static void exporterTask(void *args) {
+	exporter.run();
+}
+
+void Exporter::begin() {
+	memory.createTask(
+		exporterTask,
+		"exporter", "exporter",
+		EXPORTER_STACK_SIZE,
+		NULL,
+		1, tskNO_AFFINITY,
+		TASK_STORAGE_OF(exporter)
+	);
+}
+
+// reads every counter, the formatting in prometheus.cpp does not touch the platform
+void Exporter::collect(MetricsSnapshot *snapshot) {
+	snapshot->scansDecoded = scansDecoded.read();
+	snapshot->scansDropped = scansDropped.read();
+	snapshot->scansTruncated = scanArena.truncated;
+	snapshot->scansRendered = scansRendered.read();
+
+	snapshot->scanQueue = uxQueueMessagesWaiting(scanQueue);
+	snapshot->uplinkQueue = uxQueueMessagesWaiting(uplink.queue);
+	snapshot->lookupQueue = lookup.pending();
+
+	snapshot->arenaUsed = scanArena.used();
+
+	renderTime.read(&snapshot->renderTime);
+	transferTime.read(&snapshot->transferTime);
+
+	snapshot->displayTransfers = displayTransfers.read();
+	snapshot->displayBytes = displayBytes.read();
+
+	snapshot->uplinkBatches = uplink.batches;
+	snapshot->uplinkScans = uplink.scans;
+	snapshot->uplinkBytes = uplink.bytes;
+	snapshot->uplinkDropped = uplink.dropped + uplink.overflow + uplink.truncated;
+
+	snapshot->lookupHits = lookup.hits;
+	snapshot->lookupMisses = lookup.misses;
+	snapshot->lookupTimeouts = lookup.timeouts;
+
+	lookupAnswerTime.read(&snapshot->lookupAnswerTime);
+	lookupDisplayTime.read(&snapshot->lookupDisplayTime);
+
+	const uint32_t capabilities[METRICS_HEAP_CAPABILITIES] = {
+		MALLOC_CAP_INTERNAL,
+		MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL,
+		MALLOC_CAP_SPIRAM
+	};
+
+	for (uint8_t index = 0; index < METRICS_HEAP_CAPABILITIES; index++) {
+		snapshot->heapFree[index] = heap_caps_get_free_size(capabilities[index]);
+		snapshot->heapLargestBlock[index] = heap_caps_get_largest_free_block(capabilities[index]);
+	}
+
+	snapshot->clockSynced = clockSync.timebase.synced();
+	snapshot->clockOffset = clockSync.parameters.offset;
+	snapshot->clockDrift = clockSync.parameters.drift * 1000000000 >> 32;
+	snapshot->clockDelay = clockSync.estimator.delay;
+	snapshot->clockSamples = clockSync.estimator.samples;
+	snapshot->clockRejected = clockSync.estimator.rejected;
+	snapshot->clockTimeouts = clockSync.timeouts;
+
+	snapshot->linkUp = network.ready;
+	snapshot->uptime = esp_timer_get_time() / 1000000;
+	snapshot->lastScrape = this->lastScrape;
+}
+
+void Exporter::serve(int client) {
+	int64_t start = esp_timer_get_time();
+
+	// only /trace is told apart, every other path returns the metrics
+	char request[256];
+	ssize_t received = recv(client, request, sizeof(request) - 1, 0);
+
+	request[MAX(received, 0)] = 0;
+
+#if TRACE_ENABLED
+	if (strncmp(request, "GET /trace ", 11) == 0) {
+		this->serveTrace(client);
+
+		shutdown(client, 0);
+		close(client);
+
+		return;
+	}
+#endif
+
+	MetricsSnapshot snapshot;
+	this->collect(&snapshot);
+
+	this->metrics.format(&snapshot);
+	this->metrics.send(client);
+
+	shutdown(client, 0);
+	close(client);
+
+	this->lastScrape = esp_timer_get_time() - start;
+}
+
+#if TRACE_ENABLED
+// the rings are sent in place, recording pauses until they are out
+void Exporter::serveTrace(int client) {
+	const char *header =
+		"HTTP/1.0 200 OK\r\n"
+		"Content-Type: application/octet-stream\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	send(client, header, strlen(header), 0);
+
+	trace.pause();
+
+	TraceHeader dump;
+	trace.header(&dump);
+
+	bool sent = send(client, &dump, sizeof(dump), 0) == sizeof(dump);
+
+	for (uint8_t core = 0; sent && core < TRACE_CORES; core++) {
+		const TraceRing *ring = &trace.rings[core];
+
+		sent =
+			send(client, &ring->state, sizeof(ring->state), 0) == sizeof(ring->state) &&
+			send(client, ring->events, sizeof(ring->events), 0) == sizeof(ring->events);
+	}
+
+	if (sent) {
+		send(client, trace.tasks, dump.taskCount * sizeof(TraceTask), 0);
+	}
+
+	trace.resume();
+}
+
+#endif
+
+void Exporter::run() {
+	// the stack has to be up before a socket can be bound
+	xEventGroupWaitBits(boot.ready, BOOT_NETWORK_READY, pdFALSE, pdTRUE, portMAX_DELAY);
+
+	int listener = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(EXPORTER_PORT);
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	int enable = 1;
+	setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+	if (
+		listener < 0 ||
+		bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+		listen(listener, 2) != 0
+	) {
+		ESP_LOGE("EXPORTER", "unable to listen: errno %d", errno);
+
+		memory.retire();
+		vTaskDelete(NULL);
+	}
+
+	ESP_LOGI("EXPORTER", "listening on port %u", EXPORTER_PORT);
+
+	while (true) {
+		int client = accept(listener, NULL, NULL);
+
+		if (client < 0) {
+			continue;
+		}
+
+		// a stuck scraper must not block the next one forever
+		struct timeval timeout = { 2, 0 };
+		setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+		setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+		this->serve(client);
+	}
+}
@@ -1,3 +1,6 @@
+#pragma once
+
+#include <stdint.h>
 #include <stdio.h>
 
 struct Glyph {
@@ -5,8 +8,29 @@ struct Glyph {
 	uint8_t width;
 	const uint16_t *segments;
 	uint8_t segmentCount;
+
+	// anti aliased form, NULL for 1 bit fonts
+	//
+	// runs of equal coverage in reading order: coverage << 4 | (length - 1), runs of 16 pixels
+	// or more, mostly blank or solid, carry GLYPH_RUN_EXTENDED and length - 16 in the next byte
+	const uint8_t *coverage;
+	uint16_t coverageCount;
 };
 
+#define GLYPH_RUN_EXTENDED 0x0F
+
+// reads the coverage run at index and moves past it, returns its length in pixels
+static inline int glyphRun(const Glyph *glyph, uint16_t *index, uint8_t *level) {
+	uint8_t run = glyph->coverage[(*index)++];
+	*level = run >> 4;
+
+	if ((run & 0x0F) != GLYPH_RUN_EXTENDED) {
+		return (run & 0x0F) + 1;
+	}
+
+	return glyph->coverage[(*index)++] + 16;
+}
+
 struct Font {
 	uint8_t height;
 	const Glyph *glyphs;
@@ -5,6 +5,8 @@
 //
 // source font: 'GT Pressura Mono' 40px
 //
+// coverage by /font/coverage.js from the 1 bit segments
+//
 static const uint16_t glyph97Monospace40Data[] = { 472, 5, 14, 10, 11, 12, 9, 14, 8, 7, 1, 6, 7, 5, 5, 5, 7, 5, 6, 5, 17, 5, 11, 11, 8, 14, 7, 15, 6, 16, 6, 6, 5, 5, 6, 5, 6, 5, 5, 5, 7, 5, 5, 5, 7, 5, 6, 5, 5, 6, 6, 16, 6, 16, 7, 15, 9, 7, 2, 3 };
 static const uint16_t glyph65Monospace40Data[] = { 317, 6, 15, 8, 14, 8, 14, 8, 14, 8, 13, 10, 12, 10, 12, 10, 12, 4, 2, 4, 11, 5, 2, 5, 10, 5, 2, 5, 10, 5, 2, 5, 10, 4, 4, 4, 9, 5, 4, 5, 8, 5, 4, 5, 8, 5, 4, 5, 8, 5, 4, 6, 6, 16, 6, 16, 6, 16, 5, 18, 4, 18, 4, 5, 8, 5, 4, 5, 8, 5, 3, 6, 8, 6, 2, 6, 8, 6, 2, 5, 10, 5, 2, 5, 10, 5 };
 static const uint16_t glyph98Monospace40Data[] = { 290, 4, 18, 5, 17, 5, 17, 5, 17, 5, 17, 5, 17, 5, 17, 5, 17, 5, 2, 5, 10, 14, 8, 15, 7, 16, 6, 16, 6, 7, 3, 6, 6, 6, 5, 6, 5, 5, 7, 5, 5, 5, 7, 5, 5, 5, 7, 5, 5, 5, 7, 5, 5, 5, 7, 5, 5, 5, 7, 5, 5, 5, 7, 5, 5, 5, 7, 5, 5, 6, 5, 6, 5, 16, 6, 16, 6, 15, 7, 14, 8, 4, 2, 7 };
@@ -74,75 +76,144 @@ static const uint16_t glyph44Monospace40Data[] = { 779, 6, 16, 6, 16, 6, 16, 6,
 static const uint16_t glyph46Monospace40Data[] = { 779, 6, 16, 6, 16, 6, 16, 6, 16, 6, 16, 6, 16, 6 };
 static const uint16_t glyph95Monospace40Data[] = { 905, 19, 3, 19, 3, 19, 3, 19 };
 
+static const uint8_t glyph97Monospace40Coverage[] = { 15, 255, 15, 162, 16, 48, 66, 48, 16, 11, 16, 48, 64, 96, 144, 178, 144, 96, 48, 16, 8, 16, 80, 144, 176, 192, 224, 242, 224, 192, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 5, 48, 144, 224, 243, 224, 208, 224, 242, 224, 144, 48, 4, 16, 96, 192, 241, 224, 192, 176, 144, 128, 160, 224, 242, 176, 64, 4, 48, 144, 224, 241, 192, 112, 64, 48, 32, 80, 160, 224, 241, 192, 96, 16, 3, 48, 128, 178, 128, 48, 2, 16, 96, 192, 241, 224, 144, 48, 3, 16, 48, 72, 112, 192, 242, 176, 64, 5, 16, 48, 64, 96, 144, 179, 192, 224, 242, 176, 64, 4, 16, 80, 144, 176, 192, 224, 248, 176, 64, 3, 16, 80, 160, 224, 251, 176, 64, 3, 48, 144, 224, 242, 224, 192, 178, 192, 224, 242, 176, 64, 3, 64, 176, 242, 224, 160, 96, 66, 112, 192, 242, 176, 64, 2, 16, 96, 192, 241, 224, 160, 80, 16, 2, 64, 176, 242, 176, 64, 2, 48, 144, 224, 241, 192, 96, 16, 3, 64, 176, 242, 176, 64, 2, 48, 144, 224, 241, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 16, 96, 192, 241, 224, 160, 96, 66, 96, 160, 224, 242, 176, 64, 3, 64, 176, 242, 224, 192, 178, 192, 224, 243, 176, 64, 3, 48, 144, 224, 252, 176, 64, 3, 16, 80, 144, 192, 224, 244, 224, 193, 224, 240, 224, 144, 48, 4, 16, 48, 96, 144, 180, 144, 97, 144, 176, 144, 80, 16, 6, 16, 48, 68, 48, 17, 48, 64, 48, 16, 15, 162 };
+static const uint8_t glyph65Monospace40Coverage[] = { 15, 255, 15, 7, 16, 48, 67, 48, 16, 12, 16, 80, 144, 179, 144, 80, 16, 11, 48, 144, 224, 243, 224, 144, 48, 11, 64, 176, 245, 176, 64, 11, 64, 176, 245, 176, 64, 10, 16, 96, 192, 245, 192, 96, 16, 9, 48, 144, 224, 245, 224, 144, 48, 9, 64, 176, 247, 176, 64, 9, 64, 176, 241, 224, 193, 224, 241, 176, 64, 8, 16, 96, 192, 241, 192, 113, 192, 241, 192, 96, 16, 7, 48, 144, 224, 241, 176, 65, 176, 241, 224, 144, 48, 7, 64, 176, 242, 176, 65, 176, 242, 176, 64, 7, 64, 176, 241, 224, 144, 49, 144, 224, 241, 176, 64, 6, 16, 96, 192, 241, 192, 96, 17, 96, 192, 241, 192, 96, 16, 5, 48, 144, 224, 241, 176, 64, 1, 64, 176, 241, 224, 144, 48, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 192, 112, 65, 112, 192, 242, 224, 144, 48, 3, 48, 144, 224, 242, 224, 192, 177, 192, 224, 243, 176, 64, 3, 64, 176, 253, 176, 64, 2, 16, 96, 192, 253, 192, 96, 16, 1, 48, 144, 224, 253, 224, 144, 48, 1, 64, 176, 242, 224, 192, 181, 192, 224, 242, 176, 64, 1, 64, 176, 242, 192, 112, 69, 112, 192, 242, 176, 64, 0, 16, 96, 192, 242, 176, 64, 5, 64, 176, 242, 192, 96, 0, 48, 144, 224, 242, 176, 64, 5, 64, 176, 242, 224, 144, 0, 64, 176, 242, 224, 144, 48, 5, 48, 144, 224, 242, 176, 0, 64, 176, 242, 192, 96, 16, 5, 16, 96, 192, 242, 176, 0, 48, 128, 178, 128, 48, 7, 48, 128, 178, 128, 0, 16, 48, 66, 48, 16, 7, 16, 48, 66, 48, 15, 160 };
+static const uint8_t glyph98Monospace40Coverage[] = { 15, 251, 16, 48, 65, 48, 16, 15, 0, 48, 128, 177, 144, 80, 16, 14, 64, 176, 241, 224, 144, 48, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 16, 48, 66, 48, 16, 7, 64, 176, 242, 192, 112, 96, 144, 178, 144, 96, 48, 16, 5, 64, 176, 242, 224, 193, 224, 242, 224, 192, 144, 80, 16, 4, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 252, 224, 144, 48, 3, 64, 176, 244, 224, 192, 176, 192, 224, 243, 176, 64, 3, 64, 176, 243, 224, 160, 96, 64, 96, 160, 224, 242, 192, 96, 16, 2, 64, 176, 242, 224, 160, 80, 16, 0, 16, 80, 160, 224, 241, 224, 144, 48, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 224, 160, 96, 66, 96, 160, 224, 241, 224, 144, 48, 2, 64, 176, 243, 224, 192, 178, 192, 224, 242, 192, 96, 16, 2, 64, 176, 252, 224, 144, 48, 3, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 241, 224, 193, 224, 244, 224, 160, 80, 16, 4, 48, 128, 177, 144, 97, 144, 180, 144, 80, 16, 5, 16, 48, 65, 48, 17, 48, 68, 48, 16, 15, 164 };
+static const uint8_t glyph66Monospace40Coverage[] = { 15, 255, 15, 2, 16, 48, 74, 48, 16, 6, 48, 128, 186, 144, 80, 16, 5, 64, 176, 250, 224, 160, 80, 16, 4, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 242, 224, 192, 177, 192, 224, 243, 224, 160, 80, 16, 2, 64, 176, 242, 192, 112, 65, 96, 144, 192, 224, 242, 224, 144, 48, 2, 64, 176, 242, 176, 64, 1, 16, 48, 96, 160, 224, 242, 176, 64, 2, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 176, 64, 2, 16, 80, 160, 224, 241, 224, 144, 48, 2, 64, 176, 242, 192, 112, 66, 96, 160, 224, 242, 192, 96, 16, 2, 64, 176, 242, 224, 192, 178, 192, 224, 242, 224, 144, 48, 3, 64, 176, 252, 192, 96, 16, 3, 64, 176, 252, 192, 96, 16, 3, 64, 176, 252, 224, 160, 80, 16, 2, 64, 176, 242, 224, 192, 179, 192, 224, 242, 224, 144, 48, 2, 64, 176, 242, 192, 112, 67, 96, 160, 224, 242, 176, 64, 2, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 192, 96, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 208, 128, 2, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 192, 96, 2, 64, 176, 242, 176, 64, 2, 16, 80, 160, 224, 242, 176, 64, 2, 64, 176, 242, 192, 112, 66, 96, 160, 224, 243, 176, 64, 2, 64, 176, 242, 224, 192, 178, 192, 224, 243, 224, 144, 48, 2, 64, 176, 252, 224, 160, 80, 16, 2, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 248, 224, 192, 176, 144, 80, 16, 4, 48, 128, 184, 144, 96, 64, 48, 16, 5, 16, 48, 72, 48, 16, 15, 166 };
+static const uint8_t glyph99Monospace40Coverage[] = { 15, 255, 15, 162, 16, 48, 66, 48, 16, 11, 16, 48, 64, 96, 144, 178, 144, 96, 64, 48, 16, 7, 16, 80, 144, 176, 192, 224, 242, 224, 192, 176, 144, 80, 16, 5, 16, 80, 160, 224, 248, 224, 160, 80, 16, 4, 48, 144, 224, 250, 224, 144, 48, 3, 16, 96, 192, 243, 224, 192, 176, 192, 224, 243, 176, 64, 3, 48, 144, 224, 241, 224, 192, 144, 96, 64, 96, 160, 224, 242, 192, 96, 16, 2, 64, 176, 242, 192, 112, 48, 16, 0, 16, 80, 160, 224, 241, 224, 144, 48, 2, 64, 176, 242, 176, 64, 3, 16, 80, 144, 178, 128, 48, 2, 64, 176, 242, 176, 64, 4, 16, 48, 66, 48, 16, 2, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 4, 16, 48, 65, 48, 16, 3, 64, 176, 242, 176, 64, 3, 16, 80, 144, 177, 144, 80, 16, 2, 64, 176, 242, 192, 96, 16, 2, 48, 144, 224, 241, 208, 128, 32, 2, 64, 176, 242, 224, 160, 96, 48, 32, 48, 112, 192, 242, 192, 96, 16, 2, 48, 144, 224, 242, 224, 192, 144, 128, 144, 192, 224, 242, 176, 64, 3, 16, 80, 160, 224, 243, 224, 208, 224, 243, 224, 144, 48, 4, 16, 80, 160, 224, 248, 224, 160, 80, 16, 5, 16, 80, 160, 224, 246, 224, 160, 80, 16, 7, 16, 80, 144, 182, 144, 80, 16, 9, 16, 48, 70, 48, 16, 15, 164 };
+static const uint8_t glyph67Monospace40Coverage[] = { 15, 255, 1, 16, 48, 66, 48, 16, 11, 16, 48, 64, 96, 144, 178, 144, 96, 64, 48, 16, 7, 16, 80, 144, 176, 192, 224, 242, 224, 192, 176, 144, 80, 16, 5, 16, 80, 160, 224, 248, 224, 160, 80, 16, 3, 16, 80, 160, 224, 250, 224, 160, 80, 16, 2, 48, 144, 224, 244, 224, 193, 224, 243, 224, 144, 48, 2, 64, 176, 243, 224, 192, 144, 97, 144, 192, 224, 242, 192, 96, 1, 16, 96, 192, 242, 224, 160, 96, 48, 17, 48, 112, 192, 242, 224, 144, 1, 48, 144, 224, 242, 192, 96, 16, 3, 48, 144, 224, 242, 176, 1, 64, 176, 242, 224, 144, 48, 4, 16, 96, 192, 242, 176, 1, 64, 176, 242, 192, 96, 16, 5, 48, 128, 178, 128, 1, 64, 176, 242, 176, 64, 6, 16, 48, 66, 48, 1, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 6, 16, 48, 66, 48, 1, 64, 176, 242, 176, 64, 6, 48, 128, 178, 128, 1, 64, 176, 242, 192, 96, 16, 5, 64, 176, 242, 176, 1, 64, 176, 242, 224, 144, 48, 4, 16, 96, 192, 242, 176, 1, 48, 144, 224, 242, 192, 96, 16, 2, 16, 80, 160, 224, 241, 224, 144, 1, 16, 96, 192, 242, 224, 160, 96, 66, 96, 160, 224, 242, 192, 96, 2, 48, 144, 224, 242, 224, 192, 178, 192, 224, 242, 224, 144, 48, 2, 16, 96, 192, 252, 192, 96, 16, 3, 48, 128, 192, 224, 249, 224, 144, 48, 4, 16, 48, 96, 160, 224, 246, 224, 192, 144, 80, 16, 6, 16, 80, 144, 182, 144, 96, 48, 16, 8, 16, 48, 70, 48, 16, 15, 164 };
+static const uint8_t glyph100Monospace40Coverage[] = { 15, 255, 7, 16, 48, 65, 48, 16, 14, 16, 80, 144, 177, 128, 48, 14, 48, 144, 224, 241, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 7, 16, 48, 66, 48, 16, 64, 176, 242, 176, 64, 5, 16, 48, 96, 144, 178, 144, 96, 112, 192, 242, 176, 64, 4, 16, 80, 144, 192, 224, 242, 224, 193, 224, 242, 176, 64, 3, 16, 80, 160, 224, 251, 176, 64, 3, 48, 144, 224, 252, 176, 64, 3, 64, 176, 243, 224, 192, 176, 192, 224, 244, 176, 64, 2, 16, 96, 192, 242, 224, 160, 96, 64, 96, 160, 224, 243, 176, 64, 2, 48, 144, 224, 241, 224, 160, 80, 16, 0, 16, 80, 160, 224, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 48, 144, 224, 241, 224, 160, 96, 66, 96, 160, 224, 242, 176, 64, 2, 16, 96, 192, 242, 224, 192, 178, 192, 224, 243, 176, 64, 3, 48, 144, 224, 252, 176, 64, 3, 16, 80, 160, 224, 251, 176, 64, 4, 16, 80, 160, 224, 244, 224, 193, 224, 241, 176, 64, 5, 16, 80, 144, 180, 144, 97, 144, 177, 128, 48, 6, 16, 48, 68, 48, 17, 48, 65, 48, 16, 15, 161 };
+static const uint8_t glyph68Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 74, 48, 16, 6, 48, 128, 186, 144, 96, 48, 16, 4, 64, 176, 250, 224, 192, 144, 80, 16, 3, 64, 176, 252, 224, 160, 80, 16, 2, 64, 176, 253, 224, 144, 48, 2, 64, 176, 242, 224, 192, 179, 192, 224, 243, 192, 96, 16, 1, 64, 176, 242, 192, 112, 67, 96, 160, 224, 242, 224, 144, 48, 1, 64, 176, 242, 176, 64, 3, 16, 80, 160, 224, 242, 176, 64, 1, 64, 176, 242, 176, 64, 4, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 192, 96, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 224, 144, 1, 64, 176, 242, 176, 64, 5, 64, 176, 243, 176, 1, 64, 176, 242, 176, 64, 5, 64, 176, 243, 176, 1, 64, 176, 242, 176, 64, 5, 64, 176, 243, 176, 1, 64, 176, 242, 176, 64, 5, 64, 176, 243, 176, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 224, 144, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 192, 96, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 4, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 176, 64, 3, 16, 80, 160, 224, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 1, 16, 80, 160, 224, 242, 224, 144, 48, 1, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 243, 192, 96, 16, 1, 64, 176, 243, 224, 192, 177, 192, 224, 243, 224, 144, 48, 2, 64, 176, 252, 224, 160, 80, 16, 2, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 249, 224, 192, 144, 80, 16, 4, 48, 128, 185, 144, 96, 48, 16, 5, 16, 48, 73, 48, 16, 15, 166 };
+static const uint8_t glyph101Monospace40Coverage[] = { 15, 255, 15, 162, 16, 48, 65, 48, 16, 12, 16, 48, 64, 96, 144, 177, 144, 96, 64, 48, 16, 8, 16, 80, 144, 176, 192, 224, 241, 224, 192, 176, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 5, 48, 144, 224, 242, 224, 193, 224, 242, 224, 160, 80, 16, 3, 16, 96, 192, 241, 224, 192, 144, 97, 144, 192, 224, 241, 224, 144, 48, 3, 48, 144, 224, 241, 192, 112, 48, 17, 48, 96, 160, 224, 241, 176, 64, 3, 64, 176, 241, 224, 144, 48, 3, 16, 96, 192, 241, 176, 64, 3, 64, 176, 241, 208, 128, 32, 3, 16, 96, 192, 241, 192, 96, 16, 1, 16, 96, 192, 241, 224, 160, 96, 67, 96, 160, 224, 241, 224, 144, 48, 1, 48, 144, 224, 242, 224, 192, 179, 192, 224, 243, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 144, 224, 242, 224, 192, 185, 128, 48, 1, 16, 96, 192, 241, 224, 160, 96, 73, 48, 16, 2, 64, 176, 241, 208, 128, 32, 5, 16, 48, 64, 48, 16, 3, 64, 176, 241, 224, 144, 48, 3, 16, 48, 96, 144, 176, 128, 48, 3, 64, 176, 242, 192, 96, 16, 1, 16, 80, 144, 192, 224, 240, 176, 64, 3, 48, 144, 224, 241, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 3, 16, 96, 192, 242, 224, 192, 177, 192, 224, 242, 224, 144, 48, 4, 48, 144, 224, 249, 224, 160, 80, 16, 4, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph69Monospace40Coverage[] = { 15, 255, 15, 2, 16, 48, 78, 48, 16, 2, 48, 128, 190, 128, 48, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 64, 176, 253, 224, 144, 48, 2, 64, 176, 243, 224, 192, 183, 144, 80, 16, 2, 64, 176, 243, 192, 112, 71, 48, 16, 3, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 192, 112, 71, 48, 16, 3, 64, 176, 243, 224, 192, 183, 128, 48, 3, 64, 176, 253, 176, 64, 3, 64, 176, 253, 176, 64, 3, 64, 176, 253, 176, 64, 3, 64, 176, 243, 224, 192, 183, 128, 48, 3, 64, 176, 243, 192, 112, 71, 48, 16, 3, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 192, 112, 72, 48, 16, 2, 64, 176, 243, 224, 192, 184, 128, 48, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 48, 144, 224, 253, 176, 64, 2, 16, 80, 144, 189, 128, 48, 3, 16, 48, 77, 48, 16, 15, 160 };
+static const uint8_t glyph102Monospace40Coverage[] = { 15, 255, 4, 16, 48, 68, 48, 16, 10, 16, 48, 96, 144, 180, 128, 48, 9, 16, 80, 144, 192, 224, 244, 176, 64, 8, 16, 80, 160, 224, 246, 176, 64, 8, 48, 144, 224, 247, 176, 64, 7, 16, 96, 192, 242, 224, 192, 179, 128, 48, 7, 48, 144, 224, 241, 224, 160, 96, 67, 48, 16, 7, 64, 176, 242, 192, 96, 16, 13, 64, 176, 242, 192, 96, 16, 7, 16, 48, 67, 112, 192, 242, 224, 160, 96, 67, 48, 16, 1, 48, 128, 179, 192, 224, 243, 224, 192, 179, 128, 48, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 128, 179, 192, 224, 242, 224, 192, 180, 128, 48, 1, 16, 48, 67, 112, 192, 242, 192, 112, 68, 48, 16, 7, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 168 };
+static const uint8_t glyph70Monospace40Coverage[] = { 15, 255, 15, 3, 16, 48, 77, 48, 16, 3, 48, 128, 189, 128, 48, 3, 64, 176, 253, 176, 64, 3, 64, 176, 253, 176, 64, 3, 64, 176, 252, 224, 144, 48, 3, 64, 176, 242, 224, 192, 183, 144, 80, 16, 3, 64, 176, 242, 192, 112, 71, 48, 16, 4, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 192, 112, 71, 48, 16, 4, 64, 176, 242, 224, 192, 183, 128, 48, 4, 64, 176, 252, 176, 64, 4, 64, 176, 252, 176, 64, 4, 64, 176, 252, 176, 64, 4, 64, 176, 242, 224, 192, 183, 128, 48, 4, 64, 176, 242, 192, 112, 71, 48, 16, 4, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 171 };
+static const uint8_t glyph103Monospace40Coverage[] = { 15, 255, 15, 161, 16, 48, 65, 48, 16, 13, 16, 48, 96, 144, 177, 144, 96, 48, 32, 48, 65, 48, 16, 5, 16, 80, 144, 192, 224, 241, 224, 192, 144, 128, 144, 177, 128, 48, 4, 16, 80, 160, 224, 245, 224, 208, 224, 241, 176, 64, 3, 16, 80, 160, 224, 251, 176, 64, 3, 48, 144, 224, 242, 224, 192, 176, 192, 224, 244, 176, 64, 3, 64, 176, 242, 224, 160, 96, 64, 96, 160, 224, 243, 176, 64, 2, 16, 96, 192, 242, 192, 96, 16, 0, 16, 80, 160, 224, 242, 176, 64, 2, 48, 144, 224, 241, 224, 144, 48, 2, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 3, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 3, 64, 176, 242, 176, 64, 2, 48, 144, 224, 241, 224, 144, 48, 2, 16, 96, 192, 242, 176, 64, 2, 16, 96, 192, 242, 192, 96, 16, 0, 16, 80, 160, 224, 242, 176, 64, 3, 64, 176, 242, 224, 160, 96, 64, 96, 160, 224, 243, 176, 64, 3, 48, 144, 224, 242, 224, 192, 176, 192, 224, 244, 176, 64, 3, 16, 80, 160, 224, 251, 176, 64, 4, 16, 80, 160, 224, 250, 176, 64, 5, 16, 80, 144, 192, 224, 241, 224, 193, 224, 242, 176, 64, 6, 16, 48, 96, 144, 177, 144, 96, 112, 192, 242, 176, 64, 3, 16, 48, 70, 48, 16, 64, 176, 242, 176, 64, 3, 32, 112, 160, 177, 144, 80, 16, 1, 16, 96, 192, 242, 176, 64, 3, 16, 96, 192, 241, 224, 160, 96, 65, 96, 160, 224, 241, 224, 144, 48, 4, 64, 176, 242, 224, 192, 177, 192, 224, 242, 192, 96, 16, 4, 48, 144, 224, 249, 224, 144, 48, 5, 16, 80, 160, 224, 246, 224, 192, 144, 80, 16, 6, 16, 80, 144, 177, 192, 225, 192, 176, 144, 96, 48, 16, 8, 16, 48, 65, 96, 145, 96, 64, 48, 16, 14, 16, 49, 16, 7 };
+static const uint8_t glyph71Monospace40Coverage[] = { 15, 255, 0, 16, 48, 67, 48, 16, 11, 16, 48, 96, 144, 179, 144, 96, 64, 48, 16, 7, 16, 80, 144, 192, 224, 243, 224, 192, 176, 144, 80, 16, 5, 16, 80, 160, 224, 248, 224, 160, 80, 16, 3, 16, 80, 160, 224, 250, 224, 160, 80, 16, 2, 48, 144, 224, 244, 224, 193, 224, 243, 224, 144, 48, 1, 16, 96, 192, 243, 224, 192, 144, 97, 160, 224, 243, 176, 64, 1, 48, 144, 224, 242, 224, 160, 96, 48, 17, 80, 160, 224, 242, 192, 96, 1, 64, 176, 242, 224, 160, 80, 16, 2, 16, 96, 192, 242, 224, 144, 1, 64, 176, 242, 192, 96, 16, 4, 48, 144, 224, 241, 224, 144, 1, 64, 176, 242, 176, 64, 5, 16, 80, 144, 177, 144, 80, 0, 16, 96, 192, 242, 176, 64, 6, 16, 48, 65, 48, 16, 0, 48, 144, 224, 242, 176, 64, 13, 64, 176, 243, 176, 64, 2, 16, 48, 69, 48, 16, 0, 64, 176, 243, 176, 64, 1, 16, 80, 144, 181, 144, 80, 0, 64, 176, 243, 176, 64, 1, 48, 144, 224, 245, 224, 144, 0, 64, 176, 243, 176, 64, 1, 64, 176, 247, 176, 0, 64, 176, 243, 176, 64, 1, 64, 176, 247, 176, 0, 64, 176, 243, 176, 64, 1, 48, 128, 177, 192, 224, 243, 176, 0, 48, 144, 224, 242, 176, 64, 1, 16, 48, 65, 96, 160, 224, 242, 176, 0, 16, 96, 192, 242, 176, 64, 5, 32, 128, 208, 242, 176, 1, 64, 176, 242, 176, 64, 5, 48, 144, 224, 241, 224, 144, 1, 64, 176, 242, 192, 96, 16, 4, 64, 176, 242, 192, 96, 1, 64, 176, 242, 224, 160, 80, 16, 2, 16, 96, 192, 242, 176, 64, 1, 48, 144, 224, 242, 224, 160, 96, 66, 96, 160, 224, 242, 176, 64, 1, 16, 96, 192, 243, 224, 192, 178, 192, 224, 242, 224, 144, 48, 2, 48, 144, 224, 252, 192, 96, 16, 2, 16, 80, 160, 224, 249, 224, 192, 128, 48, 4, 16, 80, 144, 192, 224, 246, 224, 160, 96, 48, 16, 5, 16, 48, 96, 144, 182, 144, 80, 16, 9, 16, 48, 70, 48, 16, 15, 164 };
+static const uint8_t glyph104Monospace40Coverage[] = { 15, 252, 16, 48, 65, 48, 16, 14, 16, 80, 144, 177, 128, 48, 14, 48, 144, 224, 241, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 16, 48, 66, 48, 16, 7, 64, 176, 242, 192, 112, 96, 144, 178, 144, 96, 48, 16, 5, 64, 176, 242, 224, 193, 224, 242, 224, 192, 144, 80, 16, 4, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 252, 224, 144, 48, 3, 64, 176, 244, 224, 192, 176, 192, 224, 243, 176, 64, 3, 64, 176, 243, 224, 160, 96, 64, 96, 160, 224, 242, 176, 64, 3, 64, 176, 242, 224, 160, 80, 16, 0, 16, 80, 160, 224, 241, 192, 96, 16, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 241, 224, 144, 48, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 241, 224, 144, 48, 2, 48, 128, 178, 128, 48, 4, 48, 128, 177, 144, 80, 16, 2, 16, 48, 66, 48, 16, 4, 16, 48, 65, 48, 16, 15, 161 };
+static const uint8_t glyph72Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 66, 48, 16, 5, 16, 48, 66, 48, 16, 1, 48, 128, 178, 128, 48, 5, 48, 128, 178, 128, 48, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 224, 160, 96, 67, 96, 160, 224, 242, 176, 64, 1, 64, 176, 243, 224, 192, 179, 192, 224, 243, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 242, 224, 192, 181, 192, 224, 242, 176, 64, 1, 64, 176, 242, 192, 112, 69, 112, 192, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 48, 128, 178, 128, 48, 5, 48, 128, 178, 128, 48, 1, 16, 48, 66, 48, 16, 5, 16, 48, 66, 48, 16, 15, 160 };
+static const uint8_t glyph105Monospace40Coverage[] = { 15, 255, 15, 8, 16, 48, 66, 48, 16, 14, 48, 128, 178, 128, 48, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 16, 16, 48, 71, 48, 16, 9, 48, 128, 183, 128, 48, 9, 64, 176, 247, 176, 64, 9, 64, 176, 247, 176, 64, 9, 48, 128, 178, 192, 224, 242, 176, 64, 9, 16, 48, 66, 112, 192, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 8, 16, 48, 67, 112, 192, 242, 192, 112, 67, 48, 16, 2, 48, 128, 179, 192, 224, 242, 224, 192, 179, 128, 48, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 48, 128, 190, 128, 48, 2, 16, 48, 78, 48, 16, 15, 160 };
+static const uint8_t glyph73Monospace40Coverage[] = { 15, 255, 15, 2, 16, 48, 77, 48, 16, 3, 48, 128, 189, 128, 48, 3, 64, 176, 253, 176, 64, 3, 64, 176, 253, 176, 64, 3, 64, 176, 253, 176, 64, 3, 48, 128, 178, 192, 224, 243, 224, 192, 178, 128, 48, 3, 16, 48, 66, 112, 192, 243, 192, 112, 66, 48, 16, 8, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 7, 16, 48, 67, 112, 192, 243, 192, 112, 67, 48, 16, 1, 48, 128, 179, 192, 224, 243, 224, 192, 179, 128, 48, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 144, 224, 253, 224, 144, 48, 1, 16, 80, 144, 189, 144, 80, 16, 2, 16, 48, 77, 48, 16, 15, 161 };
+static const uint8_t glyph106Monospace40Coverage[] = { 15, 255, 15, 11, 16, 48, 66, 48, 16, 14, 48, 128, 178, 128, 48, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 14, 16, 48, 73, 48, 16, 7, 48, 128, 185, 128, 48, 7, 64, 176, 249, 176, 64, 7, 64, 176, 249, 176, 64, 7, 48, 128, 180, 192, 224, 242, 176, 64, 7, 16, 48, 68, 112, 192, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 4, 16, 48, 66, 48, 16, 2, 64, 176, 242, 176, 64, 4, 48, 128, 178, 128, 48, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 192, 96, 16, 0, 16, 96, 192, 242, 176, 64, 4, 48, 144, 224, 241, 224, 160, 96, 64, 96, 160, 224, 241, 224, 144, 48, 4, 16, 96, 192, 242, 224, 192, 176, 192, 224, 242, 192, 96, 16, 5, 48, 144, 224, 248, 224, 144, 48, 6, 16, 80, 160, 224, 246, 224, 160, 80, 16, 7, 16, 80, 144, 177, 192, 208, 192, 177, 144, 80, 16, 9, 16, 48, 65, 96, 128, 96, 65, 48, 16, 14, 16, 32, 16, 9 };
+static const uint8_t glyph74Monospace40Coverage[] = { 15, 255, 15, 13, 16, 48, 66, 48, 16, 14, 48, 128, 178, 128, 48, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 2, 16, 48, 65, 48, 16, 5, 64, 176, 242, 176, 64, 1, 16, 80, 144, 177, 128, 48, 5, 64, 176, 242, 176, 64, 1, 48, 144, 224, 241, 192, 96, 16, 4, 64, 176, 242, 176, 64, 1, 64, 176, 242, 224, 144, 48, 4, 64, 176, 242, 176, 64, 1, 48, 144, 224, 242, 176, 64, 3, 16, 96, 192, 242, 176, 64, 1, 16, 96, 192, 242, 192, 96, 16, 1, 16, 80, 160, 224, 242, 176, 64, 2, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 224, 144, 48, 2, 48, 144, 224, 242, 224, 192, 177, 192, 224, 243, 192, 96, 16, 2, 16, 96, 192, 251, 224, 144, 48, 4, 48, 144, 224, 249, 224, 160, 80, 16, 4, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 166 };
+static const uint8_t glyph107Monospace40Coverage[] = { 15, 252, 16, 48, 65, 48, 16, 15, 0, 48, 128, 177, 128, 48, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 3, 16, 48, 67, 48, 16, 3, 64, 176, 241, 176, 64, 3, 48, 128, 179, 128, 48, 3, 64, 176, 241, 176, 64, 2, 16, 96, 192, 242, 224, 144, 48, 3, 64, 176, 241, 176, 64, 1, 16, 80, 160, 224, 241, 224, 160, 80, 16, 3, 64, 176, 241, 176, 64, 0, 16, 80, 160, 224, 241, 224, 160, 80, 16, 4, 64, 176, 241, 176, 64, 16, 80, 160, 224, 241, 224, 160, 80, 16, 5, 64, 176, 241, 192, 112, 96, 160, 224, 242, 192, 96, 16, 6, 64, 176, 241, 224, 193, 224, 242, 224, 144, 48, 7, 64, 176, 247, 224, 160, 80, 16, 7, 64, 176, 246, 224, 160, 80, 16, 8, 64, 176, 246, 208, 128, 32, 9, 64, 176, 246, 224, 160, 80, 16, 8, 64, 176, 247, 224, 160, 80, 16, 7, 64, 176, 241, 224, 193, 224, 242, 224, 160, 80, 16, 6, 64, 176, 241, 192, 112, 96, 160, 224, 242, 224, 144, 48, 6, 64, 176, 241, 176, 64, 16, 80, 160, 224, 242, 192, 96, 16, 5, 64, 176, 241, 176, 64, 0, 16, 96, 192, 242, 224, 160, 80, 16, 4, 64, 176, 241, 176, 64, 1, 48, 144, 224, 242, 224, 160, 80, 16, 3, 64, 176, 241, 176, 64, 1, 16, 80, 160, 224, 242, 224, 144, 48, 3, 64, 176, 241, 176, 64, 2, 16, 80, 160, 224, 242, 176, 64, 3, 48, 128, 177, 128, 48, 3, 16, 80, 144, 178, 128, 48, 3, 16, 48, 65, 48, 16, 4, 16, 48, 66, 48, 16, 15, 160 };
+static const uint8_t glyph75Monospace40Coverage[] = { 15, 255, 15, 2, 16, 48, 66, 48, 16, 4, 16, 48, 67, 48, 2, 48, 128, 178, 128, 48, 4, 48, 128, 179, 128, 2, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 224, 144, 2, 64, 176, 242, 176, 64, 2, 16, 80, 160, 224, 241, 224, 160, 80, 2, 64, 176, 242, 176, 64, 1, 16, 80, 160, 224, 242, 192, 96, 16, 2, 64, 176, 242, 176, 64, 1, 48, 144, 224, 242, 224, 144, 48, 3, 64, 176, 242, 176, 64, 0, 16, 96, 192, 242, 224, 160, 80, 16, 3, 64, 176, 242, 176, 64, 16, 80, 160, 224, 242, 192, 96, 16, 4, 64, 176, 242, 176, 64, 48, 144, 224, 242, 224, 144, 48, 5, 64, 176, 242, 176, 80, 96, 192, 242, 224, 160, 80, 16, 5, 64, 176, 242, 192, 128, 160, 224, 242, 192, 96, 16, 6, 64, 176, 242, 224, 208, 224, 242, 224, 144, 48, 7, 64, 176, 247, 224, 160, 80, 16, 7, 64, 176, 247, 192, 96, 16, 8, 64, 176, 247, 176, 64, 9, 64, 176, 247, 192, 96, 16, 8, 64, 176, 247, 224, 160, 80, 16, 7, 64, 176, 242, 224, 208, 224, 242, 224, 144, 48, 7, 64, 176, 242, 192, 128, 160, 224, 242, 192, 96, 16, 6, 64, 176, 242, 176, 80, 96, 192, 242, 224, 160, 80, 16, 5, 64, 176, 242, 176, 64, 48, 144, 224, 242, 224, 144, 48, 5, 64, 176, 242, 176, 64, 16, 80, 160, 224, 242, 192, 96, 16, 4, 64, 176, 242, 176, 64, 0, 16, 96, 192, 242, 224, 160, 80, 16, 3, 64, 176, 242, 176, 64, 1, 48, 144, 224, 242, 224, 144, 48, 3, 64, 176, 242, 176, 64, 1, 16, 80, 160, 224, 242, 192, 96, 16, 2, 64, 176, 242, 176, 64, 2, 16, 96, 192, 242, 224, 160, 80, 2, 64, 176, 242, 176, 64, 3, 48, 144, 224, 242, 224, 144, 2, 64, 176, 242, 176, 64, 3, 16, 80, 160, 224, 242, 176, 2, 48, 128, 178, 128, 48, 4, 16, 80, 144, 178, 128, 2, 16, 48, 66, 48, 16, 5, 16, 48, 66, 48, 15, 160 };
+static const uint8_t glyph108Monospace40Coverage[] = { 15, 252, 16, 48, 71, 48, 16, 9, 48, 128, 183, 128, 48, 9, 64, 176, 247, 176, 64, 9, 64, 176, 247, 176, 64, 9, 64, 176, 247, 176, 64, 9, 48, 128, 178, 192, 224, 242, 176, 64, 9, 16, 48, 66, 112, 192, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 8, 16, 48, 67, 112, 192, 242, 192, 112, 67, 48, 16, 2, 48, 128, 179, 192, 224, 242, 224, 192, 179, 128, 48, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 48, 128, 190, 128, 48, 2, 16, 48, 78, 48, 16, 15, 160 };
+static const uint8_t glyph76Monospace40Coverage[] = { 15, 255, 15, 3, 16, 48, 66, 48, 16, 14, 48, 128, 178, 128, 48, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 192, 96, 16, 13, 64, 176, 242, 224, 160, 96, 72, 48, 3, 64, 176, 243, 224, 192, 184, 128, 3, 64, 176, 254, 176, 3, 64, 176, 254, 176, 3, 64, 176, 253, 224, 144, 3, 48, 128, 189, 144, 80, 3, 16, 48, 77, 48, 16, 15, 160 };
+static const uint8_t glyph109Monospace40Coverage[] = { 15, 255, 15, 160, 16, 48, 64, 48, 16, 1, 16, 48, 65, 48, 16, 3, 16, 48, 66, 96, 144, 176, 144, 96, 48, 32, 80, 144, 177, 144, 80, 16, 2, 48, 128, 178, 192, 224, 240, 224, 192, 144, 128, 160, 224, 241, 224, 160, 80, 16, 1, 64, 176, 247, 224, 208, 224, 243, 224, 144, 48, 1, 64, 176, 255, 0, 192, 96, 1, 64, 176, 241, 224, 192, 176, 192, 224, 242, 224, 193, 224, 241, 224, 144, 1, 64, 176, 241, 192, 112, 64, 112, 192, 241, 224, 160, 96, 112, 192, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 192, 96, 16, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 242, 176, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 48, 144, 224, 240, 224, 144, 1, 48, 128, 177, 128, 48, 0, 48, 128, 177, 128, 48, 0, 16, 80, 144, 176, 144, 80, 1, 16, 48, 65, 48, 16, 0, 16, 48, 65, 48, 16, 1, 16, 48, 64, 48, 16, 15, 160 };
+static const uint8_t glyph77Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 67, 48, 16, 3, 16, 48, 67, 48, 16, 1, 48, 128, 179, 128, 48, 3, 48, 128, 179, 128, 48, 1, 64, 176, 243, 192, 96, 16, 1, 16, 96, 192, 243, 176, 64, 1, 64, 176, 243, 224, 144, 48, 1, 48, 144, 224, 243, 176, 64, 1, 64, 176, 244, 176, 64, 1, 64, 176, 244, 176, 64, 1, 64, 176, 244, 176, 64, 1, 64, 176, 244, 176, 64, 1, 64, 176, 244, 192, 96, 17, 96, 192, 244, 176, 64, 1, 64, 176, 244, 224, 144, 49, 144, 224, 244, 176, 64, 1, 64, 176, 245, 176, 65, 176, 245, 176, 64, 1, 64, 176, 245, 192, 96, 80, 176, 245, 176, 64, 1, 64, 176, 241, 224, 208, 224, 240, 224, 160, 128, 192, 240, 224, 208, 224, 241, 176, 64, 1, 64, 176, 241, 192, 144, 192, 241, 224, 208, 224, 240, 192, 144, 192, 241, 176, 64, 1, 64, 176, 241, 176, 128, 176, 245, 176, 128, 176, 241, 176, 64, 1, 64, 176, 241, 176, 112, 144, 224, 243, 224, 144, 112, 176, 241, 176, 64, 1, 64, 176, 241, 176, 80, 96, 192, 243, 192, 96, 80, 176, 241, 176, 64, 1, 64, 176, 241, 176, 65, 176, 243, 176, 65, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 48, 144, 224, 241, 224, 144, 48, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 16, 96, 192, 241, 192, 96, 16, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 0, 48, 128, 177, 128, 48, 0, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 0, 16, 48, 65, 48, 16, 0, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 7, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 7, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 7, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 7, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 7, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 7, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 7, 64, 176, 241, 176, 64, 1, 48, 128, 177, 128, 48, 7, 48, 128, 177, 128, 48, 1, 16, 48, 65, 48, 16, 7, 16, 48, 65, 48, 16, 15, 160 };
+static const uint8_t glyph110Monospace40Coverage[] = { 15, 255, 15, 163, 16, 48, 66, 48, 16, 7, 16, 48, 68, 96, 144, 178, 144, 96, 48, 16, 5, 48, 128, 180, 192, 224, 242, 224, 192, 144, 80, 16, 4, 64, 176, 251, 224, 144, 48, 4, 64, 176, 252, 192, 96, 16, 3, 64, 176, 243, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 48, 144, 224, 241, 176, 64, 3, 64, 176, 242, 176, 64, 3, 16, 96, 192, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 64, 176, 242, 176, 64, 4, 64, 176, 241, 176, 64, 3, 48, 128, 178, 128, 48, 4, 48, 128, 177, 128, 48, 3, 16, 48, 66, 48, 16, 4, 16, 48, 65, 48, 16, 15, 161 };
+static const uint8_t glyph78Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 67, 48, 16, 4, 16, 48, 66, 48, 16, 1, 48, 128, 179, 144, 80, 16, 3, 48, 128, 178, 128, 48, 1, 64, 176, 243, 224, 144, 48, 3, 64, 176, 242, 176, 64, 1, 64, 176, 244, 176, 64, 3, 64, 176, 242, 176, 64, 1, 64, 176, 244, 192, 96, 16, 2, 64, 176, 242, 176, 64, 1, 64, 176, 244, 224, 144, 48, 2, 64, 176, 242, 176, 64, 1, 64, 176, 245, 176, 64, 2, 64, 176, 242, 176, 64, 1, 64, 176, 245, 192, 96, 16, 1, 64, 176, 242, 176, 64, 1, 64, 176, 245, 224, 144, 48, 1, 64, 176, 242, 176, 64, 1, 64, 176, 246, 192, 96, 16, 0, 64, 176, 242, 176, 64, 1, 64, 176, 246, 224, 144, 48, 0, 64, 176, 242, 176, 64, 1, 64, 176, 247, 176, 64, 0, 64, 176, 242, 176, 64, 1, 64, 176, 242, 224, 208, 224, 241, 192, 96, 16, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 128, 160, 224, 240, 224, 144, 48, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 80, 96, 192, 241, 192, 96, 80, 176, 242, 176, 64, 1, 64, 176, 242, 176, 65, 176, 241, 224, 144, 112, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 48, 144, 224, 241, 192, 144, 192, 242, 176, 64, 1, 64, 176, 242, 176, 64, 16, 96, 192, 241, 224, 208, 224, 242, 176, 64, 1, 64, 176, 242, 176, 64, 0, 48, 144, 224, 246, 176, 64, 1, 64, 176, 242, 176, 64, 0, 16, 96, 192, 246, 176, 64, 1, 64, 176, 242, 176, 64, 1, 64, 176, 246, 176, 64, 1, 64, 176, 242, 176, 64, 1, 48, 144, 224, 245, 176, 64, 1, 64, 176, 242, 176, 64, 1, 16, 96, 192, 245, 176, 64, 1, 64, 176, 242, 176, 64, 2, 64, 176, 245, 176, 64, 1, 64, 176, 242, 176, 64, 2, 48, 144, 224, 244, 176, 64, 1, 64, 176, 242, 176, 64, 2, 16, 96, 192, 244, 176, 64, 1, 64, 176, 242, 176, 64, 3, 48, 144, 224, 243, 176, 64, 1, 64, 176, 242, 176, 64, 3, 16, 96, 192, 243, 176, 64, 1, 48, 128, 178, 128, 48, 4, 48, 128, 179, 128, 48, 1, 16, 48, 66, 48, 16, 4, 16, 48, 67, 48, 16, 15, 160 };
+static const uint8_t glyph111Monospace40Coverage[] = { 15, 255, 15, 161, 16, 48, 66, 48, 16, 12, 16, 48, 96, 144, 178, 144, 96, 64, 48, 16, 8, 16, 80, 144, 192, 224, 242, 224, 192, 176, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 4, 16, 80, 160, 224, 249, 224, 160, 80, 16, 3, 48, 144, 224, 242, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 2, 16, 96, 192, 242, 192, 96, 16, 1, 16, 96, 192, 242, 192, 96, 16, 1, 48, 144, 224, 241, 224, 144, 48, 3, 48, 144, 224, 241, 224, 144, 48, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 48, 144, 224, 241, 224, 160, 80, 16, 1, 16, 80, 160, 224, 241, 224, 144, 48, 1, 16, 96, 192, 242, 224, 160, 96, 65, 96, 160, 224, 242, 192, 96, 16, 2, 48, 144, 224, 242, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 16, 96, 192, 251, 192, 96, 16, 4, 48, 144, 224, 249, 224, 144, 48, 5, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph79Monospace40Coverage[] = { 15, 255, 0, 16, 48, 67, 48, 16, 11, 16, 48, 96, 144, 179, 144, 96, 48, 16, 7, 16, 48, 96, 144, 192, 224, 243, 224, 192, 144, 96, 48, 16, 4, 16, 80, 144, 192, 224, 247, 224, 192, 144, 80, 16, 3, 48, 144, 224, 251, 224, 144, 48, 2, 16, 96, 192, 244, 224, 193, 224, 244, 192, 96, 16, 1, 48, 144, 224, 242, 224, 192, 144, 97, 144, 192, 224, 242, 224, 144, 48, 1, 64, 176, 242, 224, 160, 96, 48, 17, 48, 96, 160, 224, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 0, 16, 96, 192, 242, 176, 64, 5, 64, 176, 242, 192, 96, 0, 48, 144, 224, 242, 176, 64, 5, 64, 176, 242, 224, 144, 0, 64, 176, 242, 224, 144, 48, 5, 48, 144, 224, 242, 176, 0, 64, 176, 242, 192, 96, 16, 5, 16, 96, 192, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 192, 96, 16, 5, 16, 96, 192, 242, 176, 0, 64, 176, 242, 224, 144, 48, 5, 48, 144, 224, 242, 176, 0, 48, 144, 224, 242, 176, 64, 5, 64, 176, 242, 224, 144, 0, 16, 96, 192, 242, 192, 96, 16, 3, 16, 96, 192, 242, 192, 96, 1, 64, 176, 242, 224, 160, 80, 16, 1, 16, 80, 160, 224, 242, 176, 64, 1, 48, 144, 224, 242, 224, 160, 96, 65, 96, 160, 224, 242, 224, 144, 48, 1, 16, 96, 192, 243, 224, 192, 177, 192, 224, 243, 192, 96, 16, 2, 48, 144, 224, 251, 224, 144, 48, 3, 16, 80, 160, 224, 249, 224, 160, 80, 16, 4, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph112Monospace40Coverage[] = { 15, 255, 15, 163, 16, 48, 66, 48, 16, 7, 16, 48, 65, 48, 32, 48, 96, 144, 178, 144, 96, 48, 16, 5, 48, 128, 177, 144, 128, 144, 192, 224, 242, 224, 192, 144, 80, 16, 4, 64, 176, 241, 224, 208, 224, 246, 224, 160, 80, 16, 3, 64, 176, 252, 224, 144, 48, 3, 64, 176, 244, 224, 192, 176, 192, 224, 243, 176, 64, 3, 64, 176, 243, 224, 160, 96, 64, 96, 160, 224, 242, 192, 96, 16, 2, 64, 176, 242, 224, 160, 80, 16, 0, 16, 80, 160, 224, 241, 224, 144, 48, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 224, 160, 96, 66, 96, 160, 224, 241, 224, 144, 48, 2, 64, 176, 243, 224, 192, 178, 192, 224, 242, 192, 96, 16, 2, 64, 176, 252, 224, 144, 48, 3, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 242, 224, 208, 224, 244, 224, 160, 80, 16, 4, 64, 176, 242, 192, 128, 144, 180, 144, 80, 16, 5, 64, 176, 242, 176, 80, 48, 68, 48, 16, 6, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 18 };
+static const uint8_t glyph80Monospace40Coverage[] = { 15, 255, 15, 2, 16, 48, 74, 48, 16, 6, 48, 128, 186, 144, 96, 48, 16, 4, 64, 176, 250, 224, 192, 144, 80, 16, 3, 64, 176, 252, 224, 144, 48, 3, 64, 176, 253, 192, 96, 16, 2, 64, 176, 242, 224, 192, 179, 192, 224, 242, 224, 144, 48, 2, 64, 176, 242, 192, 112, 67, 96, 160, 224, 242, 192, 96, 2, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 224, 144, 2, 64, 176, 242, 176, 64, 4, 64, 176, 243, 176, 2, 64, 176, 242, 176, 64, 4, 64, 176, 243, 176, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 224, 144, 2, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 192, 96, 2, 64, 176, 242, 192, 112, 67, 96, 160, 224, 242, 176, 64, 2, 64, 176, 242, 224, 192, 179, 192, 224, 242, 224, 144, 48, 2, 64, 176, 253, 192, 96, 16, 2, 64, 176, 251, 224, 192, 128, 48, 3, 64, 176, 250, 224, 160, 96, 48, 16, 3, 64, 176, 242, 224, 192, 181, 144, 80, 16, 5, 64, 176, 242, 192, 112, 69, 48, 16, 6, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 172 };
+static const uint8_t glyph113Monospace40Coverage[] = { 15, 255, 15, 160, 16, 48, 66, 48, 16, 12, 16, 48, 96, 144, 178, 144, 96, 48, 32, 48, 65, 48, 16, 4, 16, 80, 144, 192, 224, 242, 224, 192, 144, 128, 144, 177, 128, 48, 3, 16, 80, 160, 224, 246, 224, 208, 224, 241, 176, 64, 3, 48, 144, 224, 252, 176, 64, 3, 64, 176, 243, 224, 192, 176, 192, 224, 244, 176, 64, 2, 16, 96, 192, 242, 224, 160, 96, 64, 96, 160, 224, 243, 176, 64, 2, 48, 144, 224, 241, 224, 160, 80, 16, 0, 16, 80, 160, 224, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 64, 4, 64, 176, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 2, 16, 96, 192, 242, 176, 64, 2, 48, 144, 224, 241, 224, 160, 96, 66, 96, 160, 224, 242, 176, 64, 2, 16, 96, 192, 242, 224, 192, 178, 192, 224, 243, 176, 64, 3, 48, 144, 224, 252, 176, 64, 3, 16, 80, 160, 224, 251, 176, 64, 4, 16, 80, 160, 224, 244, 224, 208, 224, 242, 176, 64, 5, 16, 80, 144, 180, 144, 128, 192, 242, 176, 64, 6, 16, 48, 68, 48, 80, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 7 };
+static const uint8_t glyph81Monospace40Coverage[] = { 15, 255, 0, 16, 48, 67, 48, 16, 11, 16, 48, 96, 144, 179, 144, 96, 48, 16, 7, 16, 48, 96, 144, 192, 224, 243, 224, 192, 144, 96, 48, 16, 4, 16, 80, 144, 192, 224, 247, 224, 192, 144, 80, 16, 3, 48, 144, 224, 251, 224, 144, 48, 2, 16, 96, 192, 244, 224, 193, 224, 244, 192, 96, 16, 1, 48, 144, 224, 242, 224, 192, 144, 97, 144, 192, 224, 242, 224, 144, 48, 1, 64, 176, 242, 224, 160, 96, 48, 17, 48, 96, 160, 224, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 0, 16, 96, 192, 242, 176, 64, 5, 64, 176, 242, 192, 96, 0, 48, 144, 224, 242, 176, 64, 5, 64, 176, 242, 224, 144, 0, 64, 176, 242, 224, 144, 48, 5, 48, 144, 224, 242, 176, 0, 64, 176, 242, 192, 96, 16, 5, 16, 96, 192, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 192, 96, 16, 5, 16, 96, 192, 242, 176, 0, 64, 176, 242, 224, 144, 48, 5, 48, 144, 224, 242, 176, 0, 48, 144, 224, 242, 176, 64, 5, 64, 176, 242, 224, 144, 0, 16, 96, 192, 242, 192, 96, 16, 3, 16, 96, 192, 242, 192, 96, 1, 64, 176, 242, 224, 160, 80, 16, 1, 16, 80, 160, 224, 242, 176, 64, 1, 48, 144, 224, 242, 224, 160, 96, 65, 96, 160, 224, 242, 224, 144, 48, 1, 16, 96, 192, 243, 224, 192, 177, 192, 224, 243, 192, 96, 16, 2, 48, 144, 224, 251, 224, 144, 48, 3, 16, 80, 160, 224, 250, 192, 96, 16, 4, 16, 80, 144, 192, 224, 248, 176, 64, 6, 16, 48, 96, 144, 179, 192, 224, 242, 192, 96, 16, 7, 16, 48, 67, 96, 160, 224, 241, 224, 160, 80, 16, 12, 16, 96, 192, 242, 224, 144, 48, 13, 48, 144, 224, 242, 176, 64, 13, 16, 80, 144, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 72 };
+static const uint8_t glyph114Monospace40Coverage[] = { 15, 255, 15, 164, 16, 48, 66, 48, 16, 7, 16, 48, 65, 48, 32, 48, 96, 144, 178, 144, 96, 48, 16, 5, 48, 128, 177, 144, 128, 144, 192, 224, 242, 224, 192, 144, 80, 16, 4, 64, 176, 241, 224, 208, 224, 246, 224, 144, 48, 4, 64, 176, 252, 192, 96, 16, 3, 64, 176, 243, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 48, 144, 224, 241, 176, 64, 3, 64, 176, 242, 176, 64, 3, 16, 80, 144, 177, 128, 48, 3, 64, 176, 242, 176, 64, 4, 16, 48, 65, 48, 16, 3, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 241, 224, 144, 48, 14, 48, 128, 177, 144, 80, 16, 14, 16, 48, 65, 48, 16, 15, 172 };
+static const uint8_t glyph82Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 75, 48, 16, 5, 48, 128, 187, 144, 80, 16, 4, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 252, 224, 160, 80, 16, 2, 64, 176, 253, 224, 160, 80, 16, 1, 64, 176, 243, 224, 192, 179, 192, 224, 242, 224, 144, 48, 1, 64, 176, 243, 192, 112, 67, 96, 160, 224, 242, 176, 64, 1, 64, 176, 243, 176, 64, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 243, 176, 64, 4, 64, 176, 242, 176, 64, 1, 64, 176, 243, 176, 64, 4, 64, 176, 242, 176, 64, 1, 64, 176, 243, 176, 64, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 243, 176, 64, 2, 16, 80, 160, 224, 242, 176, 64, 1, 64, 176, 243, 192, 112, 66, 96, 160, 224, 242, 224, 144, 48, 1, 64, 176, 243, 224, 192, 178, 192, 224, 243, 192, 96, 16, 1, 64, 176, 253, 224, 144, 48, 2, 64, 176, 252, 224, 160, 80, 16, 2, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 243, 224, 193, 224, 243, 192, 96, 16, 4, 64, 176, 243, 192, 112, 96, 160, 224, 242, 192, 96, 16, 4, 64, 176, 243, 176, 64, 16, 96, 192, 242, 224, 144, 48, 4, 64, 176, 243, 176, 64, 0, 48, 144, 224, 242, 192, 96, 16, 3, 64, 176, 243, 176, 64, 0, 16, 96, 192, 242, 224, 144, 48, 3, 64, 176, 243, 176, 64, 1, 48, 144, 224, 242, 192, 96, 16, 2, 64, 176, 243, 176, 64, 1, 16, 96, 192, 242, 224, 144, 48, 2, 64, 176, 243, 176, 64, 2, 48, 144, 224, 242, 192, 96, 16, 1, 64, 176, 243, 176, 64, 2, 16, 96, 192, 242, 224, 144, 48, 1, 64, 176, 243, 176, 64, 3, 48, 144, 224, 242, 176, 64, 1, 48, 144, 224, 241, 224, 144, 48, 3, 16, 96, 192, 242, 176, 64, 1, 16, 80, 144, 177, 144, 80, 16, 4, 48, 128, 178, 128, 48, 2, 16, 48, 65, 48, 16, 5, 16, 48, 66, 48, 16, 15, 160 };
+static const uint8_t glyph115Monospace40Coverage[] = { 15, 255, 15, 161, 16, 48, 67, 48, 16, 11, 16, 48, 96, 144, 179, 144, 96, 64, 48, 16, 7, 16, 80, 144, 192, 224, 243, 224, 192, 176, 144, 80, 16, 5, 16, 80, 160, 224, 248, 224, 144, 48, 4, 16, 80, 160, 224, 241, 224, 192, 176, 192, 224, 243, 192, 96, 16, 3, 48, 144, 224, 241, 224, 160, 96, 64, 96, 144, 192, 224, 241, 224, 144, 48, 3, 64, 176, 242, 192, 96, 16, 0, 16, 48, 112, 192, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 2, 48, 128, 178, 128, 48, 3, 64, 176, 242, 224, 160, 96, 64, 48, 17, 48, 66, 48, 16, 3, 48, 144, 224, 242, 224, 192, 176, 144, 96, 65, 48, 16, 6, 16, 80, 160, 224, 244, 224, 192, 177, 144, 96, 48, 16, 5, 16, 80, 160, 224, 247, 224, 192, 144, 80, 16, 5, 16, 80, 144, 176, 192, 224, 246, 224, 144, 48, 6, 16, 48, 64, 96, 144, 177, 192, 224, 243, 176, 64, 2, 16, 48, 66, 48, 17, 48, 65, 96, 160, 224, 242, 176, 64, 2, 48, 128, 178, 128, 48, 3, 16, 96, 192, 242, 176, 64, 2, 48, 144, 224, 241, 192, 96, 16, 3, 64, 176, 242, 176, 64, 2, 16, 96, 192, 241, 224, 160, 96, 67, 112, 192, 242, 176, 64, 3, 64, 176, 242, 224, 192, 179, 192, 224, 241, 224, 144, 48, 3, 48, 144, 224, 250, 224, 160, 80, 16, 3, 16, 80, 144, 192, 224, 246, 224, 192, 144, 80, 16, 5, 16, 48, 96, 144, 182, 144, 96, 48, 16, 8, 16, 48, 70, 48, 16, 15, 165 };
+static const uint8_t glyph83Monospace40Coverage[] = { 15, 255, 1, 16, 48, 66, 48, 16, 11, 16, 48, 64, 96, 144, 178, 144, 96, 64, 48, 16, 7, 16, 80, 144, 176, 192, 224, 242, 224, 192, 176, 144, 80, 16, 5, 16, 80, 160, 224, 248, 224, 160, 80, 16, 3, 16, 80, 160, 224, 250, 224, 144, 48, 3, 48, 144, 224, 242, 224, 192, 177, 192, 224, 243, 192, 96, 16, 2, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 224, 144, 48, 1, 16, 96, 192, 242, 192, 96, 16, 1, 16, 80, 160, 224, 242, 176, 64, 1, 48, 144, 224, 242, 176, 64, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 243, 176, 64, 4, 48, 128, 178, 128, 48, 1, 48, 144, 224, 242, 192, 96, 16, 3, 16, 48, 66, 48, 16, 1, 16, 96, 192, 242, 224, 160, 96, 48, 16, 11, 64, 176, 243, 224, 192, 144, 96, 64, 48, 16, 8, 48, 144, 224, 244, 224, 192, 176, 144, 96, 48, 16, 6, 16, 80, 160, 224, 246, 224, 192, 144, 96, 48, 16, 5, 16, 80, 160, 224, 247, 224, 192, 144, 80, 16, 5, 16, 80, 144, 176, 192, 224, 246, 224, 160, 80, 16, 5, 16, 48, 64, 96, 144, 176, 192, 224, 244, 224, 144, 48, 8, 16, 48, 64, 96, 144, 192, 224, 243, 176, 64, 1, 16, 48, 65, 48, 16, 3, 16, 48, 96, 160, 224, 242, 176, 64, 1, 48, 128, 177, 144, 80, 16, 4, 16, 96, 192, 242, 176, 64, 1, 64, 176, 241, 224, 144, 48, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 224, 160, 96, 67, 96, 160, 224, 242, 176, 64, 1, 48, 144, 224, 242, 224, 192, 179, 192, 224, 242, 224, 144, 48, 1, 16, 80, 160, 224, 251, 224, 160, 80, 16, 2, 16, 80, 160, 224, 249, 224, 160, 80, 16, 4, 16, 80, 160, 224, 247, 224, 160, 80, 16, 6, 16, 80, 144, 183, 144, 80, 16, 8, 16, 48, 71, 48, 16, 15, 164 };
+static const uint8_t glyph116Monospace40Coverage[] = { 15, 255, 15, 27, 16, 48, 66, 48, 16, 14, 48, 128, 178, 128, 48, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 192, 96, 16, 8, 16, 48, 66, 112, 192, 242, 224, 160, 96, 68, 48, 16, 1, 48, 128, 178, 192, 224, 243, 224, 192, 180, 128, 48, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 128, 178, 192, 224, 242, 224, 192, 181, 128, 48, 1, 16, 48, 66, 112, 192, 242, 192, 112, 69, 48, 16, 6, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 2, 16, 48, 66, 48, 5, 64, 176, 242, 176, 64, 2, 48, 128, 178, 128, 5, 64, 176, 242, 176, 64, 2, 64, 176, 242, 176, 5, 64, 176, 242, 176, 64, 1, 16, 96, 192, 241, 224, 144, 5, 64, 176, 242, 192, 112, 48, 32, 80, 160, 224, 241, 192, 96, 5, 48, 144, 224, 241, 224, 192, 144, 128, 160, 224, 242, 176, 64, 5, 16, 96, 192, 243, 224, 208, 224, 242, 224, 144, 48, 6, 48, 144, 224, 248, 192, 96, 16, 6, 16, 80, 160, 224, 245, 224, 192, 128, 48, 8, 16, 80, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 163 };
+static const uint8_t glyph84Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 79, 0, 48, 16, 1, 48, 128, 191, 0, 128, 48, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 128, 179, 192, 224, 243, 224, 192, 179, 128, 48, 1, 16, 48, 67, 112, 192, 243, 192, 112, 67, 48, 16, 7, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 144, 224, 241, 224, 144, 48, 13, 16, 80, 144, 177, 144, 80, 16, 14, 16, 48, 65, 48, 16, 15, 167 };
+static const uint8_t glyph117Monospace40Coverage[] = { 15, 255, 15, 178, 16, 48, 66, 48, 16, 3, 16, 48, 66, 48, 16, 3, 48, 128, 178, 128, 48, 3, 48, 128, 178, 128, 48, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 3, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 3, 64, 176, 243, 224, 192, 177, 192, 224, 243, 176, 64, 3, 48, 144, 224, 252, 176, 64, 3, 16, 80, 160, 224, 251, 176, 64, 4, 16, 80, 160, 224, 244, 224, 193, 224, 241, 176, 64, 5, 16, 80, 144, 180, 144, 97, 144, 177, 128, 48, 6, 16, 48, 68, 48, 17, 48, 65, 48, 16, 15, 161 };
+static const uint8_t glyph85Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 66, 48, 16, 5, 16, 48, 66, 48, 16, 1, 48, 128, 178, 128, 48, 5, 48, 128, 178, 128, 48, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 224, 160, 80, 16, 1, 16, 80, 160, 224, 242, 176, 64, 1, 48, 144, 224, 242, 224, 160, 96, 65, 96, 160, 224, 242, 224, 144, 48, 1, 16, 96, 192, 243, 224, 192, 177, 192, 224, 243, 192, 96, 16, 2, 48, 144, 224, 251, 224, 144, 48, 3, 16, 80, 160, 224, 249, 224, 160, 80, 16, 4, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph118Monospace40Coverage[] = { 15, 255, 15, 177, 16, 48, 66, 48, 16, 5, 16, 48, 66, 48, 16, 1, 48, 128, 178, 128, 48, 5, 48, 128, 178, 128, 48, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 48, 144, 224, 241, 192, 96, 16, 3, 16, 96, 192, 241, 224, 144, 48, 1, 16, 96, 192, 241, 224, 144, 48, 3, 48, 144, 224, 241, 192, 96, 16, 2, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 48, 144, 224, 241, 192, 96, 16, 1, 16, 96, 192, 241, 224, 144, 48, 3, 16, 96, 192, 241, 224, 144, 48, 1, 48, 144, 224, 241, 192, 96, 16, 4, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 48, 144, 224, 241, 192, 96, 17, 96, 192, 241, 224, 144, 48, 5, 16, 96, 192, 241, 224, 144, 49, 144, 224, 241, 192, 96, 16, 6, 64, 176, 242, 176, 65, 176, 242, 176, 64, 7, 48, 144, 224, 241, 192, 113, 192, 241, 224, 144, 48, 7, 16, 96, 192, 241, 224, 193, 224, 241, 192, 96, 16, 8, 48, 144, 224, 245, 224, 144, 48, 9, 16, 96, 192, 245, 192, 96, 16, 10, 64, 176, 245, 176, 64, 11, 48, 144, 224, 243, 224, 144, 48, 11, 16, 96, 192, 243, 192, 96, 16, 12, 48, 144, 224, 241, 224, 144, 48, 13, 16, 80, 144, 177, 144, 80, 16, 14, 16, 48, 65, 48, 16, 15, 167 };
+static const uint8_t glyph86Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 66, 48, 16, 5, 16, 48, 67, 48, 1, 48, 128, 178, 128, 48, 5, 48, 128, 178, 160, 112, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 192, 96, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 4, 64, 176, 242, 176, 64, 1, 64, 176, 242, 224, 144, 48, 3, 16, 96, 192, 242, 176, 64, 1, 48, 144, 224, 242, 176, 64, 3, 48, 144, 224, 241, 224, 144, 48, 1, 16, 96, 192, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 2, 64, 176, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 3, 48, 144, 224, 241, 224, 144, 48, 1, 48, 144, 224, 242, 176, 64, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 224, 144, 48, 4, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 4, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 192, 96, 17, 96, 192, 242, 176, 64, 5, 48, 144, 224, 241, 224, 144, 49, 144, 224, 241, 224, 144, 48, 5, 16, 96, 192, 242, 176, 65, 176, 242, 192, 96, 16, 6, 64, 176, 242, 176, 65, 176, 242, 176, 64, 7, 64, 176, 242, 176, 65, 176, 242, 176, 64, 7, 64, 176, 242, 192, 113, 192, 242, 176, 64, 7, 48, 144, 224, 241, 224, 193, 224, 241, 224, 144, 48, 7, 16, 96, 192, 247, 192, 96, 16, 8, 64, 176, 247, 176, 64, 9, 64, 176, 247, 176, 64, 9, 48, 144, 224, 245, 224, 144, 48, 9, 16, 96, 192, 245, 192, 96, 16, 10, 64, 176, 245, 176, 64, 11, 64, 176, 245, 176, 64, 11, 48, 128, 181, 128, 48, 11, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph119Monospace40Coverage[] = { 15, 255, 15, 176, 16, 48, 65, 48, 16, 9, 16, 48, 65, 48, 0, 48, 128, 177, 144, 80, 16, 7, 16, 80, 144, 177, 128, 0, 64, 176, 241, 224, 144, 48, 7, 48, 144, 224, 241, 176, 0, 48, 144, 224, 241, 176, 64, 7, 64, 176, 241, 224, 144, 0, 16, 96, 192, 241, 176, 64, 0, 16, 48, 65, 48, 16, 0, 64, 176, 241, 192, 96, 1, 64, 176, 241, 176, 64, 0, 48, 128, 177, 128, 48, 0, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 1, 64, 176, 241, 176, 64, 16, 96, 192, 241, 192, 96, 16, 64, 176, 241, 176, 64, 1, 64, 176, 241, 192, 96, 64, 144, 224, 241, 224, 144, 64, 96, 192, 241, 176, 64, 1, 64, 176, 241, 224, 144, 112, 176, 243, 176, 112, 144, 224, 241, 176, 64, 1, 48, 144, 224, 241, 176, 128, 176, 243, 176, 128, 176, 241, 224, 144, 48, 1, 16, 96, 192, 241, 192, 144, 192, 243, 192, 144, 192, 241, 192, 96, 16, 2, 64, 176, 241, 224, 208, 224, 243, 224, 208, 224, 241, 176, 64, 3, 64, 176, 244, 224, 193, 224, 244, 176, 64, 3, 64, 176, 244, 192, 113, 192, 244, 176, 64, 3, 64, 176, 244, 176, 65, 176, 244, 176, 64, 3, 48, 144, 224, 243, 176, 65, 176, 243, 224, 144, 48, 3, 16, 96, 192, 242, 224, 144, 49, 144, 224, 242, 192, 96, 16, 4, 64, 176, 242, 192, 96, 17, 96, 192, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 48, 128, 178, 128, 48, 1, 48, 128, 178, 128, 48, 5, 16, 48, 66, 48, 16, 1, 16, 48, 66, 48, 16, 15, 162 };
+static const uint8_t glyph87Monospace40Coverage[] = { 15, 255, 15, 0, 16, 48, 66, 48, 16, 7, 16, 48, 66, 48, 0, 48, 128, 178, 128, 48, 7, 48, 128, 178, 128, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 7, 64, 176, 242, 176, 0, 64, 176, 242, 176, 64, 0, 16, 48, 65, 48, 16, 0, 64, 176, 242, 176, 0, 48, 144, 224, 241, 176, 64, 0, 48, 128, 177, 128, 48, 0, 64, 176, 241, 224, 144, 0, 16, 96, 192, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 241, 192, 96, 1, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 0, 64, 176, 241, 176, 64, 1, 64, 176, 241, 192, 96, 32, 96, 192, 241, 192, 96, 16, 64, 176, 241, 176, 64, 1, 64, 176, 241, 224, 144, 96, 144, 224, 241, 224, 144, 64, 96, 192, 241, 176, 64, 1, 64, 176, 242, 176, 128, 176, 243, 176, 112, 144, 224, 241, 176, 64, 1, 64, 176, 242, 176, 128, 176, 243, 176, 128, 176, 242, 176, 64, 1, 64, 176, 242, 176, 128, 176, 243, 176, 128, 176, 242, 176, 64, 1, 64, 176, 242, 176, 128, 176, 243, 176, 128, 176, 242, 176, 64, 1, 64, 176, 242, 176, 128, 176, 243, 176, 128, 176, 242, 176, 64, 1, 64, 176, 242, 192, 144, 192, 243, 192, 144, 192, 242, 176, 64, 1, 48, 144, 224, 241, 224, 208, 224, 240, 224, 208, 225, 208, 224, 241, 224, 144, 48, 1, 16, 96, 192, 244, 224, 160, 128, 192, 244, 192, 96, 16, 2, 64, 176, 244, 192, 96, 80, 176, 244, 176, 64, 3, 64, 176, 244, 176, 65, 176, 244, 176, 64, 3, 64, 176, 244, 176, 65, 176, 244, 176, 64, 3, 64, 176, 244, 176, 65, 176, 244, 176, 64, 3, 64, 176, 244, 176, 64, 48, 144, 224, 243, 176, 64, 3, 64, 176, 243, 224, 144, 48, 16, 96, 192, 243, 176, 64, 3, 64, 176, 243, 192, 96, 16, 0, 64, 176, 243, 176, 64, 3, 48, 128, 179, 128, 48, 1, 48, 128, 179, 128, 48, 3, 16, 48, 67, 48, 16, 1, 16, 48, 67, 48, 16, 15, 161 };
+static const uint8_t glyph120Monospace40Coverage[] = { 15, 255, 15, 177, 16, 48, 67, 48, 16, 4, 16, 48, 66, 48, 16, 1, 48, 128, 179, 128, 48, 3, 16, 80, 144, 178, 128, 48, 1, 48, 144, 224, 242, 192, 96, 16, 1, 16, 80, 160, 224, 241, 224, 144, 48, 1, 16, 80, 160, 224, 241, 224, 160, 80, 16, 0, 48, 144, 224, 241, 224, 160, 80, 16, 2, 16, 96, 192, 242, 224, 144, 48, 16, 96, 192, 242, 192, 96, 16, 4, 48, 144, 224, 242, 192, 112, 96, 160, 224, 241, 224, 144, 48, 5, 16, 80, 160, 224, 241, 224, 193, 224, 241, 224, 160, 80, 16, 6, 16, 80, 160, 224, 246, 192, 96, 16, 8, 16, 96, 192, 245, 224, 144, 48, 10, 48, 144, 224, 243, 224, 160, 80, 16, 10, 32, 128, 208, 243, 208, 128, 32, 11, 48, 144, 224, 243, 224, 160, 80, 16, 9, 16, 96, 192, 245, 224, 144, 48, 8, 16, 80, 160, 224, 246, 192, 96, 16, 7, 48, 144, 224, 241, 224, 193, 224, 241, 224, 160, 80, 16, 5, 16, 96, 192, 242, 192, 113, 192, 242, 224, 144, 48, 4, 16, 80, 160, 224, 241, 224, 144, 49, 144, 224, 242, 192, 96, 16, 2, 16, 80, 160, 224, 241, 224, 160, 80, 17, 80, 160, 224, 241, 224, 160, 80, 16, 1, 48, 144, 224, 242, 192, 96, 16, 1, 16, 96, 192, 242, 224, 144, 48, 1, 64, 176, 242, 224, 144, 48, 3, 48, 144, 224, 242, 176, 64, 1, 48, 128, 178, 144, 80, 16, 3, 16, 80, 144, 178, 128, 48, 1, 16, 48, 66, 48, 16, 5, 16, 48, 66, 48, 16, 15, 160 };
+static const uint8_t glyph88Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 66, 48, 16, 5, 16, 48, 66, 48, 16, 1, 48, 128, 178, 144, 80, 16, 3, 16, 80, 144, 178, 128, 48, 1, 64, 176, 242, 224, 144, 48, 3, 48, 144, 224, 242, 176, 64, 1, 48, 144, 224, 242, 176, 64, 3, 64, 176, 242, 224, 144, 48, 1, 16, 96, 192, 242, 192, 96, 16, 1, 16, 96, 192, 242, 192, 96, 16, 2, 48, 144, 224, 241, 224, 144, 48, 1, 48, 144, 224, 241, 224, 144, 48, 3, 16, 96, 192, 242, 192, 96, 17, 96, 192, 242, 192, 96, 16, 4, 48, 144, 224, 241, 224, 144, 49, 144, 224, 241, 224, 144, 48, 5, 16, 96, 192, 242, 192, 113, 192, 242, 192, 96, 16, 6, 48, 144, 224, 241, 224, 193, 224, 241, 224, 144, 48, 7, 16, 96, 192, 247, 192, 96, 16, 8, 48, 144, 224, 245, 224, 144, 48, 9, 16, 96, 192, 245, 192, 96, 16, 10, 48, 144, 224, 243, 224, 144, 48, 11, 32, 128, 208, 243, 208, 128, 32, 11, 48, 144, 224, 243, 224, 144, 48, 10, 16, 96, 192, 245, 192, 96, 16, 9, 48, 144, 224, 245, 224, 144, 48, 8, 16, 96, 192, 247, 192, 96, 16, 7, 48, 144, 224, 242, 224, 208, 224, 241, 224, 144, 48, 6, 16, 96, 192, 242, 224, 160, 128, 192, 242, 192, 96, 16, 5, 48, 144, 224, 242, 192, 96, 80, 176, 242, 224, 144, 48, 4, 16, 96, 192, 242, 224, 144, 49, 144, 224, 242, 192, 96, 16, 3, 48, 144, 224, 242, 192, 96, 17, 96, 192, 242, 224, 144, 48, 2, 16, 96, 192, 242, 224, 144, 48, 1, 48, 144, 224, 242, 192, 96, 16, 1, 48, 144, 224, 242, 192, 96, 16, 1, 16, 96, 192, 242, 224, 144, 48, 0, 16, 96, 192, 242, 224, 144, 48, 3, 48, 144, 224, 242, 192, 96, 0, 48, 144, 224, 242, 192, 96, 16, 3, 16, 96, 192, 242, 224, 144, 0, 48, 128, 179, 128, 48, 5, 48, 128, 179, 128, 0, 16, 48, 67, 48, 16, 5, 16, 48, 67, 48, 15, 160 };
+static const uint8_t glyph121Monospace40Coverage[] = { 15, 255, 15, 176, 16, 48, 67, 48, 16, 5, 16, 48, 66, 48, 16, 0, 32, 112, 160, 178, 128, 48, 5, 48, 128, 178, 128, 48, 0, 16, 96, 192, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 48, 144, 224, 241, 224, 144, 48, 3, 48, 144, 224, 241, 224, 144, 48, 1, 16, 96, 192, 242, 192, 96, 16, 1, 16, 96, 192, 242, 192, 96, 16, 2, 48, 144, 224, 241, 224, 144, 48, 1, 48, 144, 224, 241, 224, 144, 48, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 4, 64, 176, 242, 192, 96, 17, 96, 192, 242, 176, 64, 5, 48, 144, 224, 241, 224, 144, 49, 144, 224, 241, 224, 144, 48, 5, 16, 96, 192, 242, 176, 65, 176, 242, 192, 96, 16, 6, 48, 144, 224, 241, 192, 113, 192, 242, 176, 64, 7, 16, 96, 192, 241, 224, 193, 224, 241, 224, 144, 48, 8, 64, 176, 247, 192, 96, 16, 8, 48, 144, 224, 245, 224, 144, 48, 9, 16, 96, 192, 245, 192, 96, 16, 10, 48, 144, 224, 244, 176, 64, 11, 16, 96, 192, 243, 224, 144, 48, 12, 48, 144, 224, 242, 192, 96, 16, 12, 32, 128, 208, 241, 224, 144, 48, 13, 48, 144, 224, 241, 192, 96, 16, 12, 16, 96, 192, 242, 176, 64, 13, 48, 144, 224, 241, 224, 144, 48, 13, 64, 176, 242, 192, 96, 16, 12, 16, 96, 192, 241, 224, 144, 48, 13, 48, 144, 224, 241, 192, 96, 16, 13, 64, 176, 242, 176, 64, 14, 48, 128, 178, 128, 48, 14, 16, 48, 66, 48, 16, 15, 15 };
+static const uint8_t glyph89Monospace40Coverage[] = { 15, 255, 15, 0, 16, 48, 66, 48, 16, 7, 16, 48, 66, 48, 0, 48, 128, 178, 144, 80, 16, 5, 16, 80, 144, 178, 128, 0, 48, 144, 224, 241, 224, 144, 48, 5, 48, 144, 224, 241, 224, 144, 0, 16, 96, 192, 242, 192, 96, 16, 3, 16, 96, 192, 242, 192, 96, 1, 48, 144, 224, 241, 224, 144, 48, 3, 48, 144, 224, 241, 224, 144, 48, 1, 16, 96, 192, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 2, 64, 176, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 3, 48, 144, 224, 241, 224, 144, 48, 1, 48, 144, 224, 241, 224, 144, 48, 3, 16, 96, 192, 242, 192, 96, 17, 96, 192, 242, 192, 96, 16, 4, 48, 144, 224, 241, 224, 144, 49, 144, 224, 241, 224, 144, 48, 5, 16, 96, 192, 242, 176, 65, 176, 242, 192, 96, 16, 6, 64, 176, 242, 192, 113, 192, 242, 176, 64, 7, 48, 144, 224, 241, 224, 193, 224, 241, 224, 144, 48, 7, 16, 96, 192, 247, 192, 96, 16, 8, 48, 144, 224, 245, 224, 144, 48, 9, 16, 96, 192, 245, 192, 96, 16, 10, 48, 144, 224, 243, 224, 144, 48, 11, 16, 96, 192, 243, 192, 96, 16, 12, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 144, 224, 241, 224, 144, 48, 13, 16, 80, 144, 177, 144, 80, 16, 14, 16, 48, 65, 48, 16, 15, 167 };
+static const uint8_t glyph122Monospace40Coverage[] = { 15, 255, 15, 178, 16, 48, 77, 48, 16, 3, 48, 128, 189, 128, 48, 3, 64, 176, 253, 176, 64, 3, 64, 176, 253, 176, 64, 3, 48, 128, 182, 192, 224, 244, 176, 64, 3, 16, 48, 69, 80, 128, 208, 243, 224, 144, 48, 11, 48, 144, 224, 242, 224, 160, 80, 16, 10, 16, 96, 192, 242, 224, 160, 80, 16, 10, 16, 80, 160, 224, 241, 224, 160, 80, 16, 10, 16, 80, 160, 224, 241, 224, 160, 80, 16, 10, 16, 80, 160, 224, 242, 192, 96, 16, 10, 16, 80, 160, 224, 242, 224, 144, 48, 10, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 10, 48, 144, 224, 243, 208, 128, 80, 69, 48, 16, 3, 64, 176, 244, 224, 192, 182, 144, 80, 16, 2, 64, 176, 253, 224, 144, 48, 2, 64, 176, 254, 176, 64, 2, 64, 176, 253, 224, 144, 48, 2, 48, 128, 189, 144, 80, 16, 2, 16, 48, 77, 48, 16, 15, 161 };
+static const uint8_t glyph90Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 79, 0, 48, 16, 1, 48, 128, 191, 0, 128, 48, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 144, 224, 254, 176, 64, 1, 16, 80, 144, 183, 192, 224, 243, 224, 144, 48, 2, 16, 48, 70, 80, 128, 208, 243, 192, 96, 16, 11, 48, 144, 224, 242, 224, 144, 48, 11, 16, 96, 192, 243, 192, 96, 16, 10, 16, 80, 160, 224, 242, 224, 144, 48, 11, 48, 144, 224, 242, 224, 160, 80, 16, 10, 16, 96, 192, 243, 192, 96, 16, 11, 48, 144, 224, 242, 224, 144, 48, 11, 16, 96, 192, 242, 224, 160, 80, 16, 10, 16, 80, 160, 224, 242, 192, 96, 16, 11, 48, 144, 224, 242, 224, 144, 48, 11, 16, 96, 192, 242, 224, 160, 80, 16, 10, 16, 80, 160, 224, 242, 192, 96, 16, 11, 48, 144, 224, 242, 224, 144, 48, 11, 16, 96, 192, 242, 224, 160, 80, 16, 10, 16, 80, 160, 224, 242, 192, 96, 16, 11, 48, 144, 224, 242, 224, 144, 48, 11, 16, 96, 192, 243, 192, 96, 16, 11, 48, 144, 224, 243, 192, 112, 72, 48, 16, 1, 64, 176, 244, 224, 192, 184, 128, 48, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 128, 191, 0, 128, 48, 1, 16, 48, 79, 0, 48, 16, 15, 160 };
+static const uint8_t glyph48Monospace40Coverage[] = { 15, 255, 0, 16, 48, 67, 48, 16, 11, 16, 48, 96, 144, 179, 144, 96, 48, 16, 8, 16, 80, 144, 192, 224, 243, 224, 192, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 4, 16, 80, 160, 224, 249, 224, 160, 80, 16, 3, 48, 144, 224, 243, 224, 193, 224, 243, 224, 144, 48, 3, 64, 176, 242, 224, 192, 144, 97, 144, 192, 224, 242, 176, 64, 2, 16, 96, 192, 242, 192, 112, 48, 17, 48, 112, 192, 242, 192, 96, 16, 1, 48, 144, 224, 241, 224, 144, 48, 3, 48, 144, 224, 241, 224, 144, 48, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 48, 144, 224, 241, 224, 144, 48, 3, 48, 144, 224, 241, 224, 144, 48, 1, 16, 96, 192, 242, 192, 96, 16, 1, 16, 96, 192, 242, 192, 96, 16, 2, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 3, 48, 144, 224, 242, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 16, 96, 192, 251, 192, 96, 16, 4, 48, 128, 192, 224, 247, 224, 192, 128, 48, 5, 16, 48, 96, 160, 224, 245, 224, 160, 96, 48, 16, 7, 16, 80, 144, 181, 144, 80, 16, 10, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph49Monospace40Coverage[] = { 15, 255, 15, 8, 16, 48, 67, 48, 16, 12, 16, 80, 144, 179, 128, 48, 11, 16, 80, 160, 224, 243, 176, 64, 9, 16, 48, 96, 160, 224, 244, 176, 64, 8, 16, 80, 144, 192, 224, 245, 176, 64, 7, 16, 80, 160, 224, 247, 176, 64, 7, 48, 144, 224, 248, 176, 64, 7, 64, 176, 242, 224, 193, 224, 242, 176, 64, 7, 64, 176, 241, 224, 160, 96, 112, 192, 242, 176, 64, 7, 64, 176, 240, 224, 160, 80, 16, 64, 176, 242, 176, 64, 7, 64, 176, 224, 160, 80, 16, 0, 64, 176, 242, 176, 64, 7, 48, 128, 144, 80, 16, 1, 64, 176, 242, 176, 64, 7, 16, 49, 16, 2, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 7, 16, 48, 68, 112, 192, 242, 192, 112, 66, 48, 16, 2, 48, 128, 180, 192, 224, 242, 224, 192, 178, 128, 48, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 48, 128, 190, 128, 48, 2, 16, 48, 78, 48, 16, 15, 160 };
+static const uint8_t glyph50Monospace40Coverage[] = { 15, 255, 1, 16, 48, 65, 48, 16, 12, 16, 48, 64, 96, 144, 177, 144, 96, 64, 48, 16, 8, 16, 80, 144, 176, 192, 224, 241, 224, 192, 176, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 5, 48, 144, 224, 249, 224, 160, 80, 16, 3, 16, 96, 192, 242, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 48, 144, 224, 241, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 3, 64, 176, 242, 176, 64, 3, 64, 176, 242, 192, 96, 16, 2, 64, 176, 241, 224, 144, 48, 3, 64, 176, 242, 208, 128, 32, 2, 48, 128, 177, 144, 80, 16, 3, 64, 176, 242, 192, 96, 16, 2, 16, 48, 65, 48, 16, 3, 16, 96, 192, 242, 176, 64, 13, 48, 144, 224, 242, 176, 64, 12, 16, 96, 192, 242, 224, 144, 48, 11, 16, 80, 160, 224, 242, 192, 96, 16, 10, 16, 80, 160, 224, 242, 224, 144, 48, 10, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 9, 16, 80, 160, 224, 242, 224, 160, 80, 16, 10, 48, 144, 224, 243, 192, 96, 16, 11, 64, 176, 244, 192, 112, 71, 48, 16, 2, 64, 176, 244, 224, 192, 183, 128, 48, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 64, 176, 254, 176, 64, 2, 48, 128, 190, 128, 48, 2, 16, 48, 78, 48, 16, 15, 160 };
+static const uint8_t glyph51Monospace40Coverage[] = { 15, 255, 1, 16, 48, 65, 48, 16, 12, 16, 48, 64, 96, 144, 177, 144, 96, 64, 48, 16, 8, 16, 80, 144, 176, 192, 224, 241, 224, 192, 176, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 4, 16, 80, 160, 224, 249, 224, 160, 80, 16, 3, 48, 144, 224, 242, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 2, 16, 96, 192, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 2, 48, 144, 224, 241, 224, 144, 48, 3, 64, 176, 242, 176, 64, 2, 48, 144, 224, 241, 192, 96, 16, 3, 64, 176, 242, 176, 64, 2, 16, 80, 144, 177, 128, 48, 4, 64, 176, 242, 176, 64, 3, 16, 48, 65, 48, 16, 3, 16, 96, 192, 242, 176, 64, 10, 16, 48, 64, 96, 160, 224, 241, 224, 144, 48, 9, 16, 80, 144, 176, 192, 224, 242, 192, 96, 16, 9, 48, 144, 224, 244, 224, 144, 48, 10, 64, 176, 245, 208, 128, 32, 10, 48, 144, 224, 244, 224, 160, 80, 16, 9, 16, 80, 144, 176, 192, 224, 242, 224, 144, 48, 10, 16, 48, 64, 96, 160, 224, 242, 192, 96, 16, 1, 16, 48, 65, 48, 16, 4, 16, 80, 160, 224, 241, 224, 144, 48, 1, 48, 128, 177, 144, 80, 16, 4, 16, 96, 192, 242, 176, 64, 1, 64, 176, 241, 224, 144, 48, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 4, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 48, 144, 224, 242, 176, 64, 1, 48, 144, 224, 241, 224, 160, 96, 48, 17, 48, 112, 192, 242, 224, 144, 48, 1, 16, 96, 192, 242, 224, 192, 144, 97, 144, 192, 224, 242, 192, 96, 16, 2, 48, 144, 224, 243, 224, 193, 224, 243, 224, 144, 48, 3, 16, 80, 160, 224, 249, 224, 160, 80, 16, 4, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph52Monospace40Coverage[] = { 15, 255, 15, 10, 16, 48, 68, 48, 16, 12, 48, 128, 180, 128, 48, 11, 16, 96, 192, 244, 176, 64, 11, 48, 144, 224, 244, 176, 64, 10, 16, 96, 192, 245, 176, 64, 9, 16, 80, 160, 224, 245, 176, 64, 9, 48, 144, 224, 246, 176, 64, 8, 16, 96, 192, 247, 176, 64, 8, 48, 144, 224, 241, 224, 208, 224, 242, 176, 64, 7, 16, 96, 192, 241, 224, 160, 128, 192, 242, 176, 64, 6, 16, 80, 160, 224, 241, 192, 96, 80, 176, 242, 176, 64, 6, 48, 144, 224, 241, 224, 144, 48, 64, 176, 242, 176, 64, 5, 16, 96, 192, 241, 224, 160, 80, 16, 64, 176, 242, 176, 64, 4, 16, 80, 160, 224, 241, 192, 96, 16, 0, 64, 176, 242, 176, 64, 4, 48, 144, 224, 241, 224, 144, 48, 1, 64, 176, 242, 176, 64, 3, 16, 96, 192, 242, 192, 96, 16, 1, 64, 176, 242, 176, 64, 3, 48, 144, 224, 241, 224, 144, 48, 2, 64, 176, 242, 176, 64, 2, 16, 96, 192, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 2, 48, 144, 224, 242, 192, 112, 66, 96, 160, 224, 242, 192, 112, 64, 48, 0, 64, 176, 243, 224, 192, 178, 192, 224, 243, 224, 192, 176, 128, 0, 64, 176, 255, 2, 176, 0, 64, 176, 255, 2, 176, 0, 48, 128, 184, 192, 224, 243, 224, 192, 176, 128, 0, 16, 48, 72, 96, 160, 224, 242, 192, 112, 64, 48, 11, 16, 96, 192, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 242, 176, 64, 14, 64, 176, 241, 224, 144, 48, 14, 48, 128, 177, 144, 80, 16, 14, 16, 48, 65, 48, 16, 15, 163 };
+static const uint8_t glyph53Monospace40Coverage[] = { 15, 255, 15, 2, 16, 48, 77, 48, 16, 3, 48, 128, 189, 128, 48, 3, 64, 176, 253, 176, 64, 3, 64, 176, 253, 176, 64, 3, 64, 176, 252, 224, 144, 48, 3, 64, 176, 241, 224, 192, 184, 144, 80, 16, 3, 64, 176, 241, 192, 112, 72, 48, 16, 4, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 15, 0, 64, 176, 241, 176, 64, 0, 16, 48, 65, 48, 16, 8, 64, 176, 241, 192, 112, 64, 96, 144, 177, 144, 96, 48, 16, 6, 64, 176, 241, 224, 192, 176, 192, 224, 241, 224, 192, 144, 80, 16, 5, 64, 176, 250, 224, 160, 80, 16, 4, 64, 176, 251, 224, 160, 80, 16, 3, 64, 176, 243, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 192, 96, 16, 2, 48, 128, 178, 144, 80, 16, 1, 16, 96, 192, 242, 224, 144, 48, 2, 16, 48, 66, 48, 16, 3, 48, 144, 224, 242, 176, 64, 13, 16, 96, 192, 242, 176, 64, 14, 64, 176, 242, 176, 64, 1, 16, 48, 66, 48, 16, 5, 64, 176, 242, 176, 64, 1, 48, 128, 178, 128, 48, 4, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 48, 144, 224, 241, 224, 144, 48, 1, 48, 144, 224, 241, 224, 160, 96, 48, 17, 48, 112, 192, 242, 192, 96, 16, 1, 16, 96, 192, 242, 224, 192, 144, 97, 144, 192, 224, 241, 224, 144, 48, 3, 48, 144, 224, 243, 224, 193, 224, 243, 192, 96, 16, 3, 16, 80, 160, 224, 249, 224, 144, 48, 5, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph54Monospace40Coverage[] = { 15, 255, 1, 16, 48, 66, 48, 16, 11, 16, 48, 64, 96, 144, 178, 144, 96, 64, 48, 16, 7, 16, 80, 144, 176, 192, 224, 242, 224, 192, 176, 144, 80, 16, 5, 16, 80, 160, 224, 248, 224, 160, 80, 16, 4, 48, 144, 224, 250, 224, 144, 48, 3, 16, 96, 192, 243, 224, 192, 176, 192, 224, 243, 192, 96, 16, 2, 48, 144, 224, 242, 224, 160, 96, 64, 96, 160, 224, 242, 224, 144, 48, 2, 64, 176, 242, 224, 160, 80, 16, 0, 16, 80, 160, 224, 242, 176, 64, 1, 16, 96, 192, 241, 224, 160, 80, 16, 2, 16, 80, 160, 224, 240, 224, 144, 48, 1, 48, 144, 224, 241, 192, 96, 16, 4, 16, 80, 144, 176, 144, 80, 16, 1, 64, 176, 242, 176, 64, 0, 16, 48, 65, 48, 17, 48, 64, 48, 16, 2, 64, 176, 242, 192, 112, 64, 96, 144, 177, 144, 96, 64, 48, 16, 4, 64, 176, 242, 224, 192, 176, 192, 224, 241, 224, 192, 176, 144, 80, 16, 3, 64, 176, 252, 224, 160, 80, 16, 2, 64, 176, 253, 224, 144, 48, 2, 64, 176, 244, 224, 192, 177, 192, 224, 243, 192, 96, 16, 1, 64, 176, 243, 224, 160, 96, 65, 96, 160, 224, 242, 224, 144, 48, 1, 64, 176, 243, 192, 96, 16, 1, 16, 80, 160, 224, 242, 176, 64, 1, 64, 176, 242, 224, 144, 48, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 4, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 48, 144, 224, 241, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 16, 96, 192, 241, 224, 160, 80, 16, 2, 48, 144, 224, 242, 176, 64, 2, 64, 176, 242, 224, 160, 96, 48, 32, 48, 112, 192, 242, 224, 144, 48, 2, 48, 144, 224, 242, 224, 192, 144, 128, 144, 192, 224, 242, 192, 96, 16, 2, 16, 96, 192, 244, 224, 208, 224, 243, 224, 144, 48, 4, 48, 144, 224, 249, 224, 160, 80, 16, 4, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph55Monospace40Coverage[] = { 15, 255, 15, 1, 16, 48, 79, 0, 48, 16, 1, 48, 128, 191, 0, 128, 48, 1, 64, 176, 255, 0, 176, 64, 1, 64, 176, 255, 0, 176, 64, 1, 48, 144, 224, 254, 176, 64, 1, 16, 80, 144, 184, 192, 224, 243, 176, 64, 2, 16, 48, 72, 112, 192, 242, 224, 144, 48, 12, 16, 96, 192, 242, 192, 96, 16, 12, 48, 144, 224, 241, 224, 144, 48, 12, 16, 96, 192, 242, 192, 96, 16, 12, 48, 144, 224, 241, 224, 144, 48, 13, 64, 176, 242, 192, 96, 16, 12, 16, 96, 192, 242, 176, 64, 13, 48, 144, 224, 241, 224, 144, 48, 12, 16, 96, 192, 242, 192, 96, 16, 12, 48, 144, 224, 241, 224, 144, 48, 12, 16, 96, 192, 242, 192, 96, 16, 12, 48, 144, 224, 242, 176, 64, 13, 64, 176, 242, 224, 144, 48, 12, 16, 96, 192, 242, 192, 96, 16, 12, 48, 144, 224, 241, 224, 144, 48, 12, 16, 96, 192, 242, 192, 96, 16, 12, 48, 144, 224, 241, 224, 144, 48, 12, 16, 96, 192, 242, 192, 96, 16, 12, 48, 144, 224, 242, 176, 64, 12, 16, 96, 192, 242, 224, 144, 48, 12, 48, 144, 224, 242, 192, 96, 16, 12, 64, 176, 242, 224, 144, 48, 13, 48, 128, 178, 144, 80, 16, 13, 16, 48, 66, 48, 16, 15, 170 };
+static const uint8_t glyph56Monospace40Coverage[] = { 15, 255, 1, 16, 48, 66, 48, 16, 11, 16, 48, 64, 96, 144, 178, 144, 96, 48, 16, 8, 16, 80, 144, 176, 192, 224, 242, 224, 192, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 4, 16, 80, 160, 224, 249, 224, 160, 80, 16, 3, 48, 144, 224, 242, 224, 192, 177, 192, 224, 242, 224, 144, 48, 3, 64, 176, 242, 224, 160, 96, 65, 96, 160, 224, 242, 176, 64, 2, 16, 96, 192, 241, 224, 160, 80, 16, 1, 16, 80, 160, 224, 241, 192, 96, 16, 1, 48, 144, 224, 241, 192, 96, 16, 3, 16, 96, 192, 241, 224, 144, 48, 1, 48, 144, 224, 241, 192, 96, 16, 3, 16, 96, 192, 241, 224, 144, 48, 1, 16, 96, 192, 241, 224, 144, 48, 3, 48, 144, 224, 241, 192, 96, 16, 2, 64, 176, 242, 192, 96, 16, 1, 16, 96, 192, 242, 176, 64, 3, 48, 144, 224, 241, 224, 160, 96, 65, 96, 160, 224, 241, 224, 144, 48, 3, 16, 96, 192, 242, 224, 192, 177, 192, 224, 242, 192, 96, 16, 4, 48, 144, 224, 249, 224, 144, 48, 5, 32, 128, 208, 249, 208, 128, 32, 4, 16, 80, 160, 224, 249, 224, 160, 80, 16, 2, 16, 80, 160, 224, 241, 224, 192, 178, 192, 224, 242, 224, 160, 80, 16, 1, 48, 144, 224, 242, 192, 112, 66, 96, 160, 224, 242, 224, 144, 48, 1, 64, 176, 242, 224, 144, 48, 2, 16, 80, 160, 224, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 224, 160, 96, 48, 17, 48, 96, 160, 224, 242, 176, 64, 1, 48, 144, 224, 242, 224, 192, 144, 97, 144, 192, 224, 242, 224, 144, 48, 1, 16, 80, 160, 224, 243, 224, 193, 224, 243, 224, 160, 80, 16, 2, 16, 80, 160, 224, 249, 224, 160, 80, 16, 4, 16, 80, 144, 192, 224, 245, 224, 192, 144, 80, 16, 6, 16, 48, 96, 144, 181, 144, 96, 48, 16, 9, 16, 48, 69, 48, 16, 15, 165 };
+static const uint8_t glyph57Monospace40Coverage[] = { 15, 255, 1, 16, 48, 66, 48, 16, 11, 16, 48, 64, 96, 144, 178, 144, 96, 48, 16, 8, 16, 80, 144, 176, 192, 224, 242, 224, 192, 144, 80, 16, 6, 16, 80, 160, 224, 247, 224, 160, 80, 16, 4, 16, 80, 160, 224, 249, 224, 144, 48, 4, 48, 144, 224, 242, 224, 192, 177, 192, 224, 242, 192, 96, 16, 2, 16, 96, 192, 242, 224, 160, 96, 65, 96, 160, 224, 241, 224, 144, 48, 2, 48, 144, 224, 241, 224, 160, 80, 16, 1, 16, 96, 192, 242, 176, 64, 2, 64, 176, 242, 192, 96, 16, 3, 48, 144, 224, 241, 192, 96, 16, 1, 64, 176, 242, 176, 64, 4, 16, 96, 192, 241, 224, 144, 48, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 176, 64, 5, 64, 176, 242, 176, 64, 1, 64, 176, 242, 192, 96, 16, 3, 16, 96, 192, 242, 176, 64, 1, 64, 176, 242, 224, 144, 48, 2, 16, 80, 160, 224, 242, 176, 64, 1, 48, 144, 224, 242, 192, 112, 66, 96, 160, 224, 243, 176, 64, 1, 16, 96, 192, 242, 224, 192, 178, 192, 224, 244, 176, 64, 2, 48, 144, 224, 253, 176, 64, 2, 16, 80, 160, 224, 252, 176, 64, 3, 16, 80, 144, 192, 224, 243, 224, 193, 224, 242, 176, 64, 4, 16, 48, 96, 144, 179, 144, 96, 112, 192, 242, 176, 64, 6, 16, 48, 67, 48, 16, 64, 176, 242, 176, 64, 1, 16, 48, 66, 48, 16, 4, 16, 96, 192, 242, 176, 64, 1, 48, 128, 178, 144, 80, 16, 3, 48, 144, 224, 241, 224, 144, 48, 1, 64, 176, 242, 224, 144, 48, 2, 16, 96, 192, 242, 192, 96, 16, 1, 48, 144, 224, 242, 192, 112, 66, 96, 160, 224, 242, 176, 64, 2, 16, 96, 192, 242, 224, 192, 178, 192, 224, 242, 224, 144, 48, 3, 48, 144, 224, 250, 224, 160, 80, 16, 3, 16, 80, 160, 224, 248, 224, 160, 80, 16, 5, 16, 80, 160, 224, 246, 224, 160, 80, 16, 7, 16, 80, 144, 182, 144, 80, 16, 9, 16, 48, 70, 48, 16, 15, 165 };
+static const uint8_t glyph45Monospace40Coverage[] = { 15, 255, 15, 255, 15, 63, 16, 48, 73, 48, 16, 7, 48, 128, 185, 128, 48, 7, 64, 176, 249, 176, 64, 7, 64, 176, 249, 176, 64, 7, 48, 128, 192, 224, 246, 224, 144, 48, 7, 16, 48, 96, 144, 182, 144, 80, 16, 9, 16, 48, 70, 48, 16, 15, 255, 15, 69 };
+static const uint8_t glyph58Monospace40Coverage[] = { 15, 255, 15, 183, 16, 48, 67, 48, 16, 13, 48, 128, 179, 128, 48, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 128, 179, 128, 48, 13, 16, 48, 67, 48, 16, 15, 86, 16, 48, 67, 48, 16, 13, 48, 128, 179, 128, 48, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 128, 179, 128, 48, 13, 16, 48, 67, 48, 16, 15, 166 };
+static const uint8_t glyph59Monospace40Coverage[] = { 15, 255, 15, 183, 16, 48, 67, 48, 16, 13, 48, 128, 179, 128, 48, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 128, 179, 128, 48, 13, 16, 48, 67, 48, 16, 15, 86, 16, 48, 67, 48, 16, 13, 48, 128, 179, 128, 48, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 144, 224, 242, 176, 64, 13, 16, 96, 192, 241, 224, 144, 48, 14, 64, 176, 241, 192, 96, 16, 13, 16, 96, 192, 240, 224, 144, 48, 14, 48, 144, 225, 160, 80, 16, 14, 48, 128, 176, 144, 80, 16, 15, 0, 16, 48, 64, 48, 16, 15, 59 };
+static const uint8_t glyph44Monospace40Coverage[] = { 15, 255, 15, 255, 15, 198, 16, 48, 67, 48, 16, 13, 48, 128, 179, 128, 48, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 128, 192, 224, 241, 176, 64, 13, 16, 64, 128, 208, 240, 224, 144, 48, 14, 48, 144, 224, 240, 192, 96, 16, 14, 64, 176, 240, 224, 144, 48, 14, 16, 96, 192, 240, 192, 96, 16, 14, 32, 112, 160, 176, 128, 48, 15, 0, 16, 48, 65, 48, 16, 15, 58 };
+static const uint8_t glyph46Monospace40Coverage[] = { 15, 255, 15, 255, 15, 198, 16, 48, 67, 48, 16, 13, 48, 128, 179, 128, 48, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 64, 176, 243, 176, 64, 13, 48, 128, 179, 128, 48, 13, 16, 48, 67, 48, 16, 15, 166 };
+static const uint8_t glyph95Monospace40Coverage[] = { 15, 255, 15, 255, 15, 255, 15, 53, 16, 48, 79, 1, 48, 1, 48, 128, 191, 1, 128, 1, 64, 176, 255, 1, 176, 1, 64, 176, 255, 1, 176, 1, 48, 128, 191, 1, 128, 1, 16, 48, 79, 1, 48, 15, 94 };
+
 static const Glyph Monospace40Glyphs[] = {
-	{ 'a', 22, glyph97Monospace40Data, 60},
-	{ 'A', 22, glyph65Monospace40Data, 86},
-	{ 'b', 22, glyph98Monospace40Data, 84},
-	{ 'B', 22, glyph66Monospace40Data, 84},
-	{ 'c', 22, glyph99Monospace40Data, 56},
-	{ 'C', 22, glyph67Monospace40Data, 78},
-	{ 'd', 22, glyph100Monospace40Data, 84},
-	{ 'D', 22, glyph68Monospace40Data, 92},
-	{ 'e', 22, glyph101Monospace40Data, 58},
-	{ 'E', 22, glyph69Monospace40Data, 56},
-	{ 'f', 22, glyph102Monospace40Data, 58},
-	{ 'F', 22, glyph70Monospace40Data, 56},
-	{ 'g', 22, glyph103Monospace40Data, 88},
-	{ 'G', 22, glyph71Monospace40Data, 90},
-	{ 'h', 22, glyph104Monospace40Data, 92},
-	{ 'H', 22, glyph72Monospace40Data, 102},
-	{ 'i', 22, glyph105Monospace40Data, 50},
-	{ 'I', 22, glyph73Monospace40Data, 56},
-	{ 'j', 22, glyph106Monospace40Data, 74},
-	{ 'J', 22, glyph74Monospace40Data, 68},
-	{ 'k', 22, glyph107Monospace40Data, 84},
-	{ 'K', 22, glyph75Monospace40Data, 98},
-	{ 'l', 22, glyph108Monospace40Data, 58},
-	{ 'L', 22, glyph76Monospace40Data, 56},
-	{ 'm', 22, glyph109Monospace40Data, 110},
-	{ 'M', 22, glyph77Monospace40Data, 130},
-	{ 'n', 22, glyph110Monospace40Data, 74},
-	{ 'N', 22, glyph78Monospace40Data, 120},
-	{ 'o', 22, glyph111Monospace40Data, 64},
-	{ 'O', 22, glyph79Monospace40Data, 96},
-	{ 'p', 22, glyph112Monospace40Data, 82},
-	{ 'P', 22, glyph80Monospace40Data, 70},
-	{ 'q', 22, glyph113Monospace40Data, 82},
-	{ 'Q', 22, glyph81Monospace40Data, 104},
-	{ 'r', 22, glyph114Monospace40Data, 52},
-	{ 'R', 22, glyph82Monospace40Data, 92},
-	{ 's', 22, glyph115Monospace40Data, 54},
-	{ 'S', 22, glyph83Monospace40Data, 76},
-	{ 't', 22, glyph116Monospace40Data, 64},
-	{ 'T', 22, glyph84Monospace40Data, 56},
-	{ 'u', 22, glyph117Monospace40Data, 72},
-	{ 'U', 22, glyph85Monospace40Data, 102},
-	{ 'v', 22, glyph118Monospace40Data, 64},
-	{ 'V', 22, glyph86Monospace40Data, 94},
-	{ 'w', 22, glyph119Monospace40Data, 90},
-	{ 'W', 22, glyph87Monospace40Data, 132},
-	{ 'x', 22, glyph120Monospace40Data, 62},
-	{ 'X', 22, glyph88Monospace40Data, 90},
-	{ 'y', 22, glyph121Monospace40Data, 76},
-	{ 'Y', 22, glyph89Monospace40Data, 78},
-	{ 'z', 22, glyph122Monospace40Data, 40},
-	{ 'Z', 22, glyph90Monospace40Data, 56},
-	{ '0', 22, glyph48Monospace40Data, 96},
-	{ '1', 22, glyph49Monospace40Data, 64},
-	{ '2', 22, glyph50Monospace40Data, 68},
-	{ '3', 22, glyph51Monospace40Data, 80},
-	{ '4', 22, glyph52Monospace40Data, 76},
-	{ '5', 22, glyph53Monospace40Data, 70},
-	{ '6', 22, glyph54Monospace40Data, 88},
-	{ '7', 22, glyph55Monospace40Data, 56},
-	{ '8', 22, glyph56Monospace40Data, 88},
-	{ '9', 22, glyph57Monospace40Data, 84},
-	{ '-', 22, glyph45Monospace40Data, 10},
-	{ ':', 22, glyph58Monospace40Data, 28},
-	{ ';', 22, glyph59Monospace40Data, 38},
-	{ ',', 22, glyph44Monospace40Data, 24},
-	{ '.', 22, glyph46Monospace40Data, 14},
-	{ '_', 22, glyph95Monospace40Data, 8}
+	{ 'a', 22, glyph97Monospace40Data, 60, glyph97Monospace40Coverage, 283},
+	{ 'A', 22, glyph65Monospace40Data, 86, glyph65Monospace40Coverage, 317},
+	{ 'b', 22, glyph98Monospace40Data, 84, glyph98Monospace40Coverage, 326},
+	{ 'B', 22, glyph66Monospace40Data, 84, glyph66Monospace40Coverage, 337},
+	{ 'c', 22, glyph99Monospace40Data, 56, glyph99Monospace40Coverage, 264},
+	{ 'C', 22, glyph67Monospace40Data, 78, glyph67Monospace40Coverage, 326},
+	{ 'd', 22, glyph100Monospace40Data, 84, glyph100Monospace40Coverage, 326},
+	{ 'D', 22, glyph68Monospace40Data, 92, glyph68Monospace40Coverage, 335},
+	{ 'e', 22, glyph101Monospace40Data, 58, glyph101Monospace40Coverage, 288},
+	{ 'E', 22, glyph69Monospace40Data, 56, glyph69Monospace40Coverage, 213},
+	{ 'f', 22, glyph102Monospace40Data, 58, glyph102Monospace40Coverage, 236},
+	{ 'F', 22, glyph70Monospace40Data, 56, glyph70Monospace40Coverage, 205},
+	{ 'g', 22, glyph103Monospace40Data, 88, glyph103Monospace40Coverage, 380},
+	{ 'G', 22, glyph71Monospace40Data, 90, glyph71Monospace40Coverage, 376},
+	{ 'h', 22, glyph104Monospace40Data, 92, glyph104Monospace40Coverage, 333},
+	{ 'H', 22, glyph72Monospace40Data, 102, glyph72Monospace40Coverage, 354},
+	{ 'i', 22, glyph105Monospace40Data, 50, glyph105Monospace40Coverage, 198},
+	{ 'I', 22, glyph73Monospace40Data, 56, glyph73Monospace40Coverage, 215},
+	{ 'j', 22, glyph106Monospace40Data, 74, glyph106Monospace40Coverage, 291},
+	{ 'J', 22, glyph74Monospace40Data, 68, glyph74Monospace40Coverage, 263},
+	{ 'k', 22, glyph107Monospace40Data, 84, glyph107Monospace40Coverage, 337},
+	{ 'K', 22, glyph75Monospace40Data, 98, glyph75Monospace40Coverage, 368},
+	{ 'l', 22, glyph108Monospace40Data, 58, glyph108Monospace40Coverage, 207},
+	{ 'L', 22, glyph76Monospace40Data, 56, glyph76Monospace40Coverage, 189},
+	{ 'm', 22, glyph109Monospace40Data, 110, glyph109Monospace40Coverage, 380},
+	{ 'M', 22, glyph77Monospace40Data, 130, glyph77Monospace40Coverage, 421},
+	{ 'n', 22, glyph110Monospace40Data, 74, glyph110Monospace40Coverage, 271},
+	{ 'N', 22, glyph78Monospace40Data, 120, glyph78Monospace40Coverage, 405},
+	{ 'o', 22, glyph111Monospace40Data, 64, glyph111Monospace40Coverage, 283},
+	{ 'O', 22, glyph79Monospace40Data, 96, glyph79Monospace40Coverage, 376},
+	{ 'p', 22, glyph112Monospace40Data, 82, glyph112Monospace40Coverage, 321},
+	{ 'P', 22, glyph80Monospace40Data, 70, glyph80Monospace40Coverage, 263},
+	{ 'q', 22, glyph113Monospace40Data, 82, glyph113Monospace40Coverage, 321},
+	{ 'Q', 22, glyph81Monospace40Data, 104, glyph81Monospace40Coverage, 408},
+	{ 'r', 22, glyph114Monospace40Data, 52, glyph114Monospace40Coverage, 211},
+	{ 'R', 22, glyph82Monospace40Data, 92, glyph82Monospace40Coverage, 357},
+	{ 's', 22, glyph115Monospace40Data, 54, glyph115Monospace40Coverage, 283},
+	{ 'S', 22, glyph83Monospace40Data, 76, glyph83Monospace40Coverage, 372},
+	{ 't', 22, glyph116Monospace40Data, 64, glyph116Monospace40Coverage, 260},
+	{ 'T', 22, glyph84Monospace40Data, 56, glyph84Monospace40Coverage, 206},
+	{ 'u', 22, glyph117Monospace40Data, 72, glyph117Monospace40Coverage, 261},
+	{ 'U', 22, glyph85Monospace40Data, 102, glyph85Monospace40Coverage, 363},
+	{ 'v', 22, glyph118Monospace40Data, 64, glyph118Monospace40Coverage, 251},
+	{ 'V', 22, glyph86Monospace40Data, 94, glyph86Monospace40Coverage, 328},
+	{ 'w', 22, glyph119Monospace40Data, 90, glyph119Monospace40Coverage, 312},
+	{ 'W', 22, glyph87Monospace40Data, 132, glyph87Monospace40Coverage, 410},
+	{ 'x', 22, glyph120Monospace40Data, 62, glyph120Monospace40Coverage, 283},
+	{ 'X', 22, glyph88Monospace40Data, 90, glyph88Monospace40Coverage, 365},
+	{ 'y', 22, glyph121Monospace40Data, 76, glyph121Monospace40Coverage, 298},
+	{ 'Y', 22, glyph89Monospace40Data, 78, glyph89Monospace40Coverage, 297},
+	{ 'z', 22, glyph122Monospace40Data, 40, glyph122Monospace40Coverage, 189},
+	{ 'Z', 22, glyph90Monospace40Data, 56, glyph90Monospace40Coverage, 252},
+	{ '0', 22, glyph48Monospace40Data, 96, glyph48Monospace40Coverage, 374},
+	{ '1', 22, glyph49Monospace40Data, 64, glyph49Monospace40Coverage, 243},
+	{ '2', 22, glyph50Monospace40Data, 68, glyph50Monospace40Coverage, 311},
+	{ '3', 22, glyph51Monospace40Data, 80, glyph51Monospace40Coverage, 373},
+	{ '4', 22, glyph52Monospace40Data, 76, glyph52Monospace40Coverage, 299},
+	{ '5', 22, glyph53Monospace40Data, 70, glyph53Monospace40Coverage, 317},
+	{ '6', 22, glyph54Monospace40Data, 88, glyph54Monospace40Coverage, 402},
+	{ '7', 22, glyph55Monospace40Data, 56, glyph55Monospace40Coverage, 235},
+	{ '8', 22, glyph56Monospace40Data, 88, glyph56Monospace40Coverage, 400},
+	{ '9', 22, glyph57Monospace40Data, 84, glyph57Monospace40Coverage, 374},
+	{ '-', 22, glyph45Monospace40Data, 10, glyph45Monospace40Coverage, 57},
+	{ ':', 22, glyph58Monospace40Data, 28, glyph58Monospace40Coverage, 114},
+	{ ';', 22, glyph59Monospace40Data, 38, glyph59Monospace40Coverage, 153},
+	{ ',', 22, glyph44Monospace40Data, 24, glyph44Monospace40Coverage, 103},
+	{ '.', 22, glyph46Monospace40Data, 14, glyph46Monospace40Coverage, 61},
+	{ '_', 22, glyph95Monospace40Data, 8, glyph95Monospace40Coverage, 45}
 };
 
 static const Font Monospace40 = { 51, Monospace40Glyphs, 68 };
@@ -1,34 +1,192 @@
 #include "esp_log.h"
 #include <stdio.h>
+#include <string.h>
 
 extern "C" {
 	#include "freertos/FreeRTOS.h"
 	#include "freertos/task.h"
 	#include "esp_system.h"
+	#include "nvs_flash.h"
 
 	void app_main();
 }
 
+#include "trace.cpp"
+#include "boot.cpp"
+#include "clock.cpp"
+#include "memory.cpp"
 #include "scan.cpp"
 #include "display.cpp"
+#include "network.cpp"
+#include "uplink.cpp"
+#include "lookup.cpp"
+#include "exporter.cpp"
+
+#define DISPLAY_BEGIN_STACK_SIZE 4096
+#define NETWORK_BEGIN_STACK_SIZE 4096
+
+Display display;
+
+TASK_STORAGE(displayBegin, DISPLAY_BEGIN_STACK_SIZE)
+TASK_STORAGE(networkBegin, NETWORK_BEGIN_STACK_SIZE)
+
+static void displayTask(void *args) {
+	display.begin();
+	boot.mark("display", BOOT_DISPLAY_READY);
+
+	memory.retire();
+	vTaskDelete(NULL);
+}
+
+static void networkTask(void *args) {
+	network.begin();
+
+	memory.retire();
+	vTaskDelete(NULL);
+}
+
+static void storageBegin() {
+	esp_err_t result = nvs_flash_init();
+
+	if (result == ESP_ERR_NVS_NO_FREE_PAGES || result == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+		ESP_ERROR_CHECK(nvs_flash_erase());
+		result = nvs_flash_init();
+	}
+
+	ESP_ERROR_CHECK(result);
+}
 
 void app_main(void) {
 	ESP_LOGI("MAIN", "start");
 
+	boot.begin();
+
+#if TRACE_ENABLED
+	trace.begin();
+#endif
+
+	memory.watch("main", "main", xTaskGetCurrentTaskHandle(), CONFIG_ESP_MAIN_TASK_STACK_SIZE);
+
+	storageBegin();
+	boot.mark("storage");
+
+	// bring up every subsystem in parallel
 	scannerBegin();
+	uplink.begin();
+	lookup.begin();
+	exporter.begin();
+	clockSync.begin();
 
-	Display display;
-	display.begin();
+	memory.createTask(
+		displayTask,
+		"display_begin", "display",
+		DISPLAY_BEGIN_STACK_SIZE,
+		NULL,
+		4, tskNO_AFFINITY,
+		TASK_STORAGE_OF(displayBegin)
+	);
+
+	memory.createTask(
+		networkTask,
+		"network_begin", "network",
+		NETWORK_BEGIN_STACK_SIZE,
+		NULL,
+		3, tskNO_AFFINITY,
+		TASK_STORAGE_OF(networkBegin)
+	);
+
+	// the last scan, kept until the display has shown it and the next one arrives
+	ScanRecord *current = NULL;
+	bool tagPending = false;
+
+	// lookup answer for the current tag
+	LookupResult answer = {};
+	bool answerKnown = false;
+	bool answerPending = false;
+
+	// the answer for the current scan has reached the panel and was timed
+	bool answerTimed = false;
+
+	bool reported = false;
 
 	while (true) {
-		if (scanReady == true) {
-			printf("%d: <", scanIndex);
-			printf(scan);
-			printf(">\n");
+		ScanRecord *record;
+
+		if (xQueueReceive(scanQueue, &record, 0) == pdTRUE) {
+			printf("%u: <%s> %s\n", record->length, record->data(), record->symbology);
+
+			uplink.submit(record);
+
+			if (current) {
+				recordRelease(current);
+			}
+
+			current = record;
+			tagPending = true;
+
+			// a miss clears the previous answer until the server replies, the start of a
+			// truncated scan is not looked up
+			answerKnown = !current->truncated && lookup.request(current->data(), &answer);
+			answerPending = true;
+			answerTimed = false;
+		}
+
+		// answers for tags no longer on screen are only cached
+		LookupResult result;
+
+		while (xQueueReceive(lookup.results, &result, 0) == pdTRUE) {
+			if (current && !current->truncated && strcmp(result.tag, current->data()) == 0) {
+				answer = result;
+				answerKnown = true;
+				answerPending = true;
+			}
+		}
+
+		if (boot.isReady(BOOT_DISPLAY_READY)) {
+			if (tagPending) {
+				const TagFamily *family = tagFamily(&tagRules, current->family);
+
+				display.presentTag(current->data(), family ? family->color : rgb(255, 255, 255));
+				scansRendered.add();
+
+				tagPending = false;
+			}
+
+			if (answerPending) {
+				if (current->truncated) {
+					display.presentLookup("TRUNCATED", rgb(255, 0, 0));
+				} else {
+					display.presentLookup(
+						answerKnown ? answer.destination : "",
+						answer.flags & LOOKUP_FLAG_HOLD ? rgb(255, 0, 0) : rgb(255, 255, 255)
+					);
+				}
+
+				answerPending = false;
+			}
+
+			// refresh returns once the panel has the frame, but holds changes back within
+			// the refresh interval, the answer only counts once its line was pushed
+			display.refresh();
+
+			if (answerKnown && !answerTimed && !display.lookupPending()) {
+				lookupDisplayTime.observe((uint32_t)esp_timer_get_time() - current->completed);
+				answerTimed = true;
+			}
+		}
 
-			display.presentTag(scan);
+		// a missing scanner or link does not hold the report back, stages marked afterwards,
+		// usb enumeration above all, are appended as they happen
+		if (
+			!reported &&
+			(boot.isReady(BOOT_REPORT_READY) || esp_timer_get_time() >= BOOT_REPORT_TIMEOUT_MS * 1000)
+		) {
+			boot.report();
+			memory.report();
 
-			scanReady = false;
+			reported = true;
+		} else if (reported && boot.hasUnreported()) {
+			boot.report();
 		}
 
 		vTaskDelay(1);
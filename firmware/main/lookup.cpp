@@ -0,0 +1,382 @@
+#pragma once
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/task.h"
+	#include "freertos/queue.h"
+	#include "freertos/semphr.h"
+	#include "esp_log.h"
+	#include "esp_timer.h"
+}
+
+#include "memory.cpp"
+#include "network.cpp"
+#include "metrics.cpp"
+#include "answer.cpp"
+
+// tag metadata server, see answer.cpp for the protocol
+
+#define LOOKUP_HOST "192.168.31.137"
+
+#define LOOKUP_STACK_SIZE 4096
+#define LOOKUP_QUEUE_LENGTH 16
+
+#define LOOKUP_RETRY_MS 1000
+
+struct LookupInflight {
+	bool used;
+	uint16_t id;
+
+	char tag[LOOKUP_TAG_LIMIT];
+	int64_t sent;
+};
+
+class Lookup {
+	public:
+		// answers ready for the display, read by the main loop
+		QueueHandle_t results = NULL;
+
+		// counters, hits, misses and overflow are written by request, the rest by the lookup task
+		uint32_t hits = 0;
+		uint32_t misses = 0;
+		uint32_t answers = 0;
+		uint32_t timeouts = 0;
+		uint32_t dropped = 0;
+		uint32_t overflow = 0;
+
+		void begin();
+
+		// true with the cached answer, otherwise the answer arrives through results
+		bool request(const char *tag, LookupResult *result);
+
+		void run();
+
+		// requests waiting to be sent
+		uint32_t pending() {
+			return uxQueueMessagesWaiting(this->requests);
+		}
+
+	private:
+		QueueHandle_t requests = NULL;
+
+		// shared by request on the main task and answer on the lookup task
+		LookupCache cache;
+		StaticSemaphore_t cacheLockControl;
+		SemaphoreHandle_t cacheLock = NULL;
+
+		LookupInflight inflight[LOOKUP_INFLIGHT_LIMIT];
+		uint8_t inflightCount = 0;
+		uint16_t nextId = 0;
+
+		int connection = -1;
+		int64_t lastAttempt = 0;
+
+		// partial responses
+		uint8_t received[LOOKUP_RESPONSE_HEADER_SIZE + LOOKUP_DESTINATION_LIMIT];
+		size_t receivedLength = 0;
+
+		bool connect();
+		void disconnect();
+
+		void send(const char *tag);
+		void receive();
+		void answer(const uint8_t *response);
+		void expire(int64_t now);
+};
+
+// shared instance declaration
+extern Lookup lookup;
+
+// shared instance definition
+Lookup lookup;
+
+TASK_STORAGE(lookup, LOOKUP_STACK_SIZE)
+QUEUE_STORAGE(lookupRequest, LOOKUP_QUEUE_LENGTH, char[LOOKUP_TAG_LIMIT])
+QUEUE_STORAGE(lookupResult, LOOKUP_QUEUE_LENGTH, LookupResult)
+
+static void lookupTask(void *args) {
+	lookup.run();
+}
+
+void Lookup::begin() {
+	this->cacheLock = xSemaphoreCreateMutexStatic(&this->cacheLockControl);
+
+	this->requests = memory.createQueue(
+		"lookup",
+		LOOKUP_QUEUE_LENGTH, LOOKUP_TAG_LIMIT,
+		QUEUE_STORAGE_OF(lookupRequest)
+	);
+
+	this->results = memory.createQueue(
+		"lookup",
+		LOOKUP_QUEUE_LENGTH, sizeof(LookupResult),
+		QUEUE_STORAGE_OF(lookupResult)
+	);
+
+	memory.account("lookup", sizeof(LookupCache), true);
+
+	memory.createTask(
+		lookupTask,
+		"lookup", "lookup",
+		LOOKUP_STACK_SIZE,
+		NULL,
+		3, tskNO_AFFINITY,
+		TASK_STORAGE_OF(lookup)
+	);
+}
+
+bool Lookup::request(const char *tag, LookupResult *result) {
+	if (strlen(tag) >= LOOKUP_TAG_LIMIT) {
+		return false;
+	}
+
+	xSemaphoreTake(this->cacheLock, portMAX_DELAY);
+	bool cached = this->cache.get(tag, esp_timer_get_time() / 1000, result);
+	xSemaphoreGive(this->cacheLock);
+
+	if (cached) {
+		this->hits++;
+
+		return true;
+	}
+
+	this->misses++;
+
+	char request[LOOKUP_TAG_LIMIT] = {};
+	strncpy(request, tag, LOOKUP_TAG_LIMIT - 1);
+
+	if (xQueueSend(this->requests, request, 0) != pdTRUE) {
+		this->overflow++;
+	}
+
+	return false;
+}
+
+bool Lookup::connect() {
+	if (this->connection >= 0) {
+		return true;
+	}
+
+	int64_t now = esp_timer_get_time();
+
+	if (!network.ready || now - this->lastAttempt < LOOKUP_RETRY_MS * 1000) {
+		return false;
+	}
+
+	this->lastAttempt = now;
+
+	int connection = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+
+	if (connection < 0) {
+		ESP_LOGE("LOOKUP", "unable to create socket: errno %d", errno);
+
+		return false;
+	}
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(LOOKUP_PORT);
+	inet_pton(AF_INET, LOOKUP_HOST, &address.sin_addr.s_addr);
+
+	if (::connect(connection, (struct sockaddr *)&address, sizeof(address)) != 0) {
+		ESP_LOGE("LOOKUP", "unable to connect: errno %d", errno);
+		close(connection);
+
+		return false;
+	}
+
+	// requests are tiny and latency bound
+	int enable = 1;
+	setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+	ESP_LOGI("LOOKUP", "connected to %s:%u", LOOKUP_HOST, LOOKUP_PORT);
+
+	this->connection = connection;
+	this->receivedLength = 0;
+
+	return true;
+}
+
+void Lookup::disconnect() {
+	shutdown(this->connection, 0);
+	close(this->connection);
+
+	this->connection = -1;
+
+	// answers to these will never arrive
+	this->timeouts += this->inflightCount;
+	this->inflightCount = 0;
+
+	for (uint8_t index = 0; index < LOOKUP_INFLIGHT_LIMIT; index++) {
+		this->inflight[index].used = false;
+	}
+}
+
+void Lookup::send(const char *tag) {
+	LookupInflight *slot = NULL;
+
+	for (uint8_t index = 0; index < LOOKUP_INFLIGHT_LIMIT; index++) {
+		// the same tag is already on its way
+		if (this->inflight[index].used && strcmp(this->inflight[index].tag, tag) == 0) {
+			return;
+		}
+
+		if (!this->inflight[index].used && slot == NULL) {
+			slot = &this->inflight[index];
+		}
+	}
+
+	if (slot == NULL || !this->connect()) {
+		this->dropped++;
+
+		return;
+	}
+
+	uint8_t length = strlen(tag);
+	uint8_t request[LOOKUP_REQUEST_HEADER_SIZE + LOOKUP_TAG_LIMIT];
+
+	uint16_t id = this->nextId++;
+
+	request[0] = id >> 8;
+	request[1] = id & 0xff;
+	request[2] = length;
+	memcpy(request + LOOKUP_REQUEST_HEADER_SIZE, tag, length);
+
+	if (::send(this->connection, request, LOOKUP_REQUEST_HEADER_SIZE + length, 0) != LOOKUP_REQUEST_HEADER_SIZE + length) {
+		ESP_LOGE("LOOKUP", "send failed: errno %d", errno);
+		this->disconnect();
+		this->dropped++;
+
+		return;
+	}
+
+	slot->used = true;
+	slot->id = id;
+	slot->sent = esp_timer_get_time();
+	strcpy(slot->tag, tag);
+
+	this->inflightCount++;
+}
+
+void Lookup::answer(const uint8_t *response) {
+	LookupResult result = {};
+	uint16_t ttl;
+	uint16_t id = lookupDecode(response, &result, &ttl);
+
+	for (uint8_t index = 0; index < LOOKUP_INFLIGHT_LIMIT; index++) {
+		LookupInflight *slot = &this->inflight[index];
+
+		if (!slot->used || slot->id != id) {
+			continue;
+		}
+
+		int64_t now = esp_timer_get_time();
+
+		strcpy(result.tag, slot->tag);
+
+		xSemaphoreTake(this->cacheLock, portMAX_DELAY);
+		this->cache.put(&result, now / 1000 + (ttl ? ttl * 1000 : LOOKUP_TTL_MS));
+		xSemaphoreGive(this->cacheLock);
+
+		xQueueSend(this->results, &result, 0);
+
+		// request to answer, the main loop measures up to the panel
+		lookupAnswerTime.observe(now - slot->sent);
+		this->answers++;
+
+		slot->used = false;
+		this->inflightCount--;
+
+		return;
+	}
+}
+
+void Lookup::receive() {
+	while (true) {
+		size_t wanted = this->receivedLength < LOOKUP_RESPONSE_HEADER_SIZE ?
+			LOOKUP_RESPONSE_HEADER_SIZE - this->receivedLength :
+			LOOKUP_RESPONSE_HEADER_SIZE + this->received[5] - this->receivedLength;
+
+		ssize_t length = recv(this->connection, this->received + this->receivedLength, wanted, MSG_DONTWAIT);
+
+		if (length == 0 || (length < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+			ESP_LOGE("LOOKUP", "connection lost");
+			this->disconnect();
+
+			return;
+		}
+
+		if (length < 0) {
+			return;
+		}
+
+		this->receivedLength += length;
+
+		// the server never sends more than LOOKUP_DESTINATION_LIMIT, anything else is a
+		// broken stream
+		if (this->receivedLength >= LOOKUP_RESPONSE_HEADER_SIZE && this->received[5] > LOOKUP_DESTINATION_LIMIT) {
+			ESP_LOGE("LOOKUP", "destination too long");
+			this->disconnect();
+
+			return;
+		}
+
+		if (
+			this->receivedLength >= LOOKUP_RESPONSE_HEADER_SIZE &&
+			this->receivedLength == LOOKUP_RESPONSE_HEADER_SIZE + this->received[5]
+		) {
+			this->answer(this->received);
+			this->receivedLength = 0;
+		}
+	}
+}
+
+void Lookup::expire(int64_t now) {
+	for (uint8_t index = 0; index < LOOKUP_INFLIGHT_LIMIT; index++) {
+		LookupInflight *slot = &this->inflight[index];
+
+		if (slot->used && now - slot->sent > LOOKUP_TIMEOUT_MS * 1000) {
+			slot->used = false;
+
+			this->inflightCount--;
+			this->timeouts++;
+		}
+	}
+}
+
+void Lookup::run() {
+	char tag[LOOKUP_TAG_LIMIT];
+
+	while (true) {
+		// send every queued request right away, answers are collected below
+		TickType_t wait = this->inflightCount ? 0 : pdMS_TO_TICKS(100);
+
+		while (xQueueReceive(this->requests, tag, wait) == pdTRUE) {
+			this->send(tag);
+			wait = 0;
+		}
+
+		if (this->connection >= 0 && this->inflightCount) {
+			fd_set readable;
+			FD_ZERO(&readable);
+			FD_SET(this->connection, &readable);
+
+			struct timeval timeout = { 0, 10 * 1000 };
+
+			if (select(this->connection + 1, &readable, NULL, NULL, &timeout) > 0) {
+				this->receive();
+			}
+		}
+
+		this->expire(esp_timer_get_time());
+	}
+}
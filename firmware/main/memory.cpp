@@ -0,0 +1,306 @@
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/task.h"
+	#include "freertos/queue.h"
+	#include "esp_attr.h"
+	#include "esp_heap_caps.h"
+	#include "esp_log.h"
+}
+
+// allocate tasks, queues and render buffers at link time instead of from the heap, on by
+// default, the heap instead with:
+//
+//   idf.py -DSTATIC_MEMORY=0 build
+#ifndef STATIC_MEMORY
+	#define STATIC_MEMORY 1
+#endif
+
+#define MEMORY_TASK_LIMIT 12
+#define MEMORY_SUBSYSTEM_LIMIT 8
+
+// storage declarations, empty when the heap is used
+#if STATIC_MEMORY
+	#define TASK_STORAGE(identifier, size) \
+		static StackType_t identifier##Stack[size]; \
+		static StaticTask_t identifier##Control;
+
+	#define TASK_STORAGE_OF(identifier) identifier##Stack, &identifier##Control
+
+	#define QUEUE_STORAGE(identifier, length, type) \
+		static uint8_t identifier##Storage[(length) * sizeof(type)]; \
+		static StaticQueue_t identifier##Control;
+
+	#define QUEUE_STORAGE_OF(identifier) identifier##Storage, &identifier##Control
+#else
+	#define TASK_STORAGE(identifier, size)
+	#define TASK_STORAGE_OF(identifier) NULL, NULL
+
+	#define QUEUE_STORAGE(identifier, length, type)
+	#define QUEUE_STORAGE_OF(identifier) NULL, NULL
+#endif
+
+struct MemoryTask {
+	const char *name;
+	const char *subsystem;
+
+	uint32_t stackSize;
+	TaskHandle_t handle;
+
+	// unused stack bytes, kept once the task has ended
+	uint32_t highWater;
+	bool retired;
+};
+
+struct MemorySubsystem {
+	const char *name;
+
+	size_t staticSize;
+	size_t heapSize;
+};
+
+class Memory {
+	public:
+		TaskHandle_t createTask(
+			TaskFunction_t function,
+			const char *name,
+			const char *subsystem,
+
+			uint32_t stackSize,
+			void *argument,
+			UBaseType_t priority,
+			BaseType_t core,
+
+			StackType_t *stack,
+			StaticTask_t *control
+		);
+
+		QueueHandle_t createQueue(
+			const char *subsystem,
+
+			UBaseType_t length,
+			UBaseType_t itemSize,
+
+			uint8_t *storage,
+			StaticQueue_t *control
+		);
+
+		// records memory owned by a subsystem outside of tasks and queues
+		void account(const char *subsystem, size_t size, bool isStatic);
+
+		// tracks a task created elsewhere, such as app_main
+		void watch(const char *name, const char *subsystem, TaskHandle_t handle, uint32_t stackSize);
+
+		// called by a task right before it deletes itself
+		void retire();
+
+		void report();
+
+	private:
+		MemoryTask tasks[MEMORY_TASK_LIMIT];
+		uint8_t taskCount = 0;
+
+		MemorySubsystem subsystems[MEMORY_SUBSYSTEM_LIMIT];
+		uint8_t subsystemCount = 0;
+
+		portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+		MemorySubsystem *findSubsystem(const char *name);
+};
+
+// shared instance declaration
+extern Memory memory;
+
+// shared instance definition
+Memory memory;
+
+MemorySubsystem *Memory::findSubsystem(const char *name) {
+	for (uint8_t index = 0; index < this->subsystemCount; index++) {
+		if (strcmp(this->subsystems[index].name, name) == 0) {
+			return &this->subsystems[index];
+		}
+	}
+
+	if (this->subsystemCount == MEMORY_SUBSYSTEM_LIMIT) {
+		return NULL;
+	}
+
+	MemorySubsystem *subsystem = &this->subsystems[this->subsystemCount++];
+	subsystem->name = name;
+	subsystem->staticSize = 0;
+	subsystem->heapSize = 0;
+
+	return subsystem;
+}
+
+void Memory::account(const char *subsystem, size_t size, bool isStatic) {
+	taskENTER_CRITICAL(&this->lock);
+
+	MemorySubsystem *entry = this->findSubsystem(subsystem);
+
+	if (entry) {
+		if (isStatic) {
+			entry->staticSize += size;
+		} else {
+			entry->heapSize += size;
+		}
+	}
+
+	taskEXIT_CRITICAL(&this->lock);
+}
+
+void Memory::watch(const char *name, const char *subsystem, TaskHandle_t handle, uint32_t stackSize) {
+	taskENTER_CRITICAL(&this->lock);
+
+	if (this->taskCount < MEMORY_TASK_LIMIT) {
+		MemoryTask *task = &this->tasks[this->taskCount++];
+
+		task->name = name;
+		task->subsystem = subsystem;
+		task->stackSize = stackSize;
+		task->handle = handle;
+		task->highWater = 0;
+		task->retired = false;
+	}
+
+	taskEXIT_CRITICAL(&this->lock);
+}
+
+TaskHandle_t Memory::createTask(
+	TaskFunction_t function,
+	const char *name,
+	const char *subsystem,
+
+	uint32_t stackSize,
+	void *argument,
+	UBaseType_t priority,
+	BaseType_t core,
+
+	StackType_t *stack,
+	StaticTask_t *control
+) {
+	TaskHandle_t handle = NULL;
+
+	if (stack && control) {
+		handle = xTaskCreateStaticPinnedToCore(
+			function, name, stackSize, argument, priority,
+			stack, control, core
+		);
+
+		this->account(subsystem, stackSize + sizeof(StaticTask_t), true);
+	} else {
+		BaseType_t created = xTaskCreatePinnedToCore(
+			function, name, stackSize, argument, priority,
+			&handle, core
+		);
+
+		ESP_ERROR_CHECK(created == pdPASS ? ESP_OK : ESP_ERR_NO_MEM);
+
+		this->account(subsystem, stackSize + sizeof(StaticTask_t), false);
+	}
+
+	assert(handle != NULL);
+
+	this->watch(name, subsystem, handle, stackSize);
+
+	return handle;
+}
+
+QueueHandle_t Memory::createQueue(
+	const char *subsystem,
+
+	UBaseType_t length,
+	UBaseType_t itemSize,
+
+	uint8_t *storage,
+	StaticQueue_t *control
+) {
+	QueueHandle_t queue;
+
+	if (storage && control) {
+		queue = xQueueCreateStatic(length, itemSize, storage, control);
+
+		this->account(subsystem, length * itemSize + sizeof(StaticQueue_t), true);
+	} else {
+		queue = xQueueCreate(length, itemSize);
+
+		ESP_ERROR_CHECK(queue ? ESP_OK : ESP_ERR_NO_MEM);
+
+		this->account(subsystem, length * itemSize + sizeof(StaticQueue_t), false);
+	}
+
+	return queue;
+}
+
+void Memory::retire() {
+	TaskHandle_t current = xTaskGetCurrentTaskHandle();
+	uint32_t highWater = uxTaskGetStackHighWaterMark(NULL);
+
+	taskENTER_CRITICAL(&this->lock);
+
+	for (uint8_t index = 0; index < this->taskCount; index++) {
+		if (this->tasks[index].handle == current && !this->tasks[index].retired) {
+			this->tasks[index].highWater = highWater;
+			this->tasks[index].retired = true;
+		}
+	}
+
+	taskEXIT_CRITICAL(&this->lock);
+}
+
+static void reportCapability(const char *name, uint32_t capabilities) {
+	ESP_LOGI(
+		"MEMORY",
+		"  %-9s free %7u  largest %7u  minimum %7u",
+		name,
+		heap_caps_get_free_size(capabilities),
+		heap_caps_get_largest_free_block(capabilities),
+		heap_caps_get_minimum_free_size(capabilities)
+	);
+}
+
+void Memory::report() {
+	ESP_LOGI("MEMORY", "mode: %s", STATIC_MEMORY ? "static" : "heap");
+
+	ESP_LOGI("MEMORY", "stacks (unused bytes of size)");
+
+	for (uint8_t index = 0; index < this->taskCount; index++) {
+		MemoryTask *task = &this->tasks[index];
+
+		uint32_t highWater = task->retired ?
+			task->highWater :
+			uxTaskGetStackHighWaterMark(task->handle);
+
+		ESP_LOGI(
+			"MEMORY",
+			"  %-14s %-8s %5lu of %5lu%s",
+			task->name,
+			task->subsystem,
+			highWater,
+			task->stackSize,
+			task->retired ? " (ended)" : ""
+		);
+	}
+
+	ESP_LOGI("MEMORY", "heap");
+	reportCapability("internal", MALLOC_CAP_INTERNAL);
+	reportCapability("dma", MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+	reportCapability("8bit", MALLOC_CAP_8BIT);
+	reportCapability("spiram", MALLOC_CAP_SPIRAM);
+
+	ESP_LOGI("MEMORY", "subsystems (static / heap bytes)");
+
+	for (uint8_t index = 0; index < this->subsystemCount; index++) {
+		ESP_LOGI(
+			"MEMORY",
+			"  %-8s %7u / %7u",
+			this->subsystems[index].name,
+			this->subsystems[index].staticSize,
+			this->subsystems[index].heapSize
+		);
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/task.h"
+	#include "esp_timer.h"
+}
+
+#include "prometheus.cpp"
+
+// monotonic counter, every core adds to its own slot so the hot path never contends
+class Counter {
+	public:
+		inline void add(uint32_t value = 1) {
+			this->values[xPortGetCoreID()].fetch_add(value, std::memory_order_relaxed);
+		}
+
+		uint32_t read() const {
+			uint32_t sum = 0;
+
+			for (uint8_t core = 0; core < portNUM_PROCESSORS; core++) {
+				sum += this->values[core].load(std::memory_order_relaxed);
+			}
+
+			return sum;
+		}
+
+	private:
+		std::atomic<uint32_t> values[portNUM_PROCESSORS] = {};
+};
+
+// distribution of durations, same per core layout as Counter
+class Histogram {
+	public:
+		inline void observe(uint32_t microseconds) {
+			uint8_t core = xPortGetCoreID();
+
+			this->buckets[core][histogramBucket(microseconds)].fetch_add(1, std::memory_order_relaxed);
+			this->sums[core].fetch_add(microseconds, std::memory_order_relaxed);
+		}
+
+		uint32_t readBucket(uint8_t bucket) const {
+			uint32_t count = 0;
+
+			for (uint8_t core = 0; core < portNUM_PROCESSORS; core++) {
+				count += this->buckets[core][bucket].load(std::memory_order_relaxed);
+			}
+
+			return count;
+		}
+
+		uint64_t readSum() const {
+			uint64_t sum = 0;
+
+			for (uint8_t core = 0; core < portNUM_PROCESSORS; core++) {
+				sum += this->sums[core].load(std::memory_order_relaxed);
+			}
+
+			return sum;
+		}
+
+		void read(HistogramSnapshot *snapshot) const {
+			for (uint8_t bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+				snapshot->buckets[bucket] = this->readBucket(bucket);
+			}
+
+			snapshot->sum = this->readSum();
+		}
+
+	private:
+		std::atomic<uint32_t> buckets[portNUM_PROCESSORS][HISTOGRAM_BUCKETS] = {};
+		std::atomic<uint64_t> sums[portNUM_PROCESSORS] = {};
+};
+
+// measures the time between construction and stop
+class Stopwatch {
+	public:
+		int64_t start = esp_timer_get_time();
+
+		inline void stop(Histogram *histogram) {
+			histogram->observe(esp_timer_get_time() - this->start);
+		}
+};
+
+// hot path counters, read by the metrics exporter
+Counter scansDecoded;
+Counter scansDropped;
+Counter scansRendered;
+
+Counter displayTransfers;
+Counter displayBytes;
+
+Histogram renderTime;
+Histogram transferTime;
+
+Histogram lookupAnswerTime;
+Histogram lookupDisplayTime;
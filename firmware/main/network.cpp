@@ -2,6 +2,7 @@
 
 #include "esp_netif_ip_addr.h"
 #include <cstring>
+#include <errno.h>
 #include <string>
 #include <sys/param.h>
 #include <sys/socket.h>
@@ -19,21 +20,95 @@ extern "C" {
 	#include "esp_eth.h"
 	#include "esp_system.h"
 	#include "esp_check.h"
+	#include "esp_timer.h"
+	#include "esp_random.h"
+	#include "nvs.h"
 }
 
+#include "boot.cpp"
+#include "memory.cpp"
+
+// how the address was obtained
+typedef enum {
+	NETWORK_SOURCE_DHCP = 0,
+	NETWORK_SOURCE_LEASE = 1,
+
+	// a fixed address provisioned into the network storage, never confirmed or renewed
+	NETWORK_SOURCE_STATIC = 2
+} network_source_t;
+
 class Network {
 	public:
 		esp_ip4_addr_t address;
 		bool ready = false;
 
+		network_source_t source = NETWORK_SOURCE_DHCP;
+		esp_netif_t *interface = NULL;
+
+		// confirms and renews a cached lease, only while the source is NETWORK_SOURCE_LEASE
+		TaskHandle_t leaseTask = NULL;
+
+		// address loaded from storage, applied once the link is up
+		esp_netif_ip_info_t stored = {};
+
+		// starts the link without waiting for an address
 		void begin();
+
+		// drop any stored address, the next boot uses DHCP
+		void forget();
+
+		// drops a cached lease and hands the address over to the DHCP client, called by the
+		// lease task once it has released the client port
+		void useDhcp();
+
+		// confirms a cached lease with the DHCP server and renews it until it fails
+		void keepLease();
+
+		bool load();
+		void store(network_source_t source, const esp_netif_ip_info_t *info);
+
+	private:
+		uint8_t requestLease(int connection, bool renewing, uint32_t *leaseTime);
+		uint8_t exchangeLease(bool renewing, uint32_t *leaseTime);
 };
 
 // shared instance declaration
 extern Network network;
 
+#undef TAG
 #define TAG "NETWORK"
 
+#define NETWORK_STORAGE "network"
+
+#define NETWORK_LEASE_STACK_SIZE 4096
+
+// a cached lease is confirmed with INIT-REBOOT requests, the address stays in use meanwhile
+#define NETWORK_LEASE_ATTEMPTS 4
+#define NETWORK_LEASE_TIMEOUT_MS 2000
+
+// renewals that go unanswered are retried until the lease runs out
+#define NETWORK_LEASE_RETRY_MS 60000
+
+#define DHCP_SERVER_PORT 67
+#define DHCP_CLIENT_PORT 68
+
+#define DHCP_HEADER_SIZE 236
+#define DHCP_PACKET_LIMIT 576
+#define DHCP_COOKIE 0x63825363
+
+#define DHCP_OPTION_MASK 1
+#define DHCP_OPTION_ROUTER 3
+#define DHCP_OPTION_REQUESTED 50
+#define DHCP_OPTION_LEASE 51
+#define DHCP_OPTION_TYPE 53
+#define DHCP_OPTION_PARAMETERS 55
+#define DHCP_OPTION_CLIENT 61
+#define DHCP_OPTION_END 255
+
+#define DHCP_REQUEST 3
+#define DHCP_ACK 5
+#define DHCP_NAK 6
+
 // address assignment callback
 static void onAddressAssign(
 	void *arg,
@@ -43,73 +118,361 @@ static void onAddressAssign(
 ) {
 	ip_event_got_ip_t *event = (ip_event_got_ip_t *)event_data;
 	network.address = event->ip_info.ip;
-	network.ready = true;
 
 	ESP_LOGI(TAG, "address assigned: " IPSTR, IP2STR(&network.address));
 
-	/*
-    xTaskCreate(
-        [](void *param) {
-            const char *server_ip = "192.168.31.137";  // <-- change to your server
-            const uint16_t server_port = 49234;        // <-- change to your server port
-
-            ESP_LOGI(TAG, "Connecting to %s:%u", server_ip, server_port);
-
-            int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
-            if (sock < 0) {
-                ESP_LOGE(TAG, "Unable to create socket: errno %d", errno);
-                vTaskDelete(nullptr);
-                return;
-            }
-
-            struct sockaddr_in dest_addr = {};
-            dest_addr.sin_family = AF_INET;
-            dest_addr.sin_port = htons(server_port);
-            inet_pton(AF_INET, server_ip, &dest_addr.sin_addr.s_addr);
-
-            int err = connect(sock, (struct sockaddr *)&dest_addr, sizeof(dest_addr));
-            if (err != 0) {
-                ESP_LOGE(TAG, "Socket unable to connect: errno %d", errno);
-                close(sock);
-                vTaskDelete(nullptr);
-                return;
-            }
-
-            ESP_LOGI(TAG, "Successfully connected");
-
-            const char *request = "Hello from ESP32-P4 over Ethernet!\n";
-            err = send(sock, request, strlen(request), 0);
-            if (err < 0) {
-                ESP_LOGE(TAG, "Error occurred during sending: errno %d", errno);
-                close(sock);
-                vTaskDelete(nullptr);
-                return;
-            }
-
-            // Optional: receive response
-            char rx_buffer[128];
-            int len = recv(sock, rx_buffer, sizeof(rx_buffer) - 1, 0);
-            if (len < 0) {
-                ESP_LOGE(TAG, "recv failed: errno %d", errno);
-            } else if (len == 0) {
-                ESP_LOGI(TAG, "Connection closed");
-            } else {
-                rx_buffer[len] = 0; // Null-terminate
-                ESP_LOGI(TAG, "Received %d bytes: '%s'", len, rx_buffer);
-            }
-
-            ESP_LOGI(TAG, "Shutting down socket");
-            shutdown(sock, 0);
-            close(sock);
-            vTaskDelete(nullptr);
-        },
-        "tcp_client_task", 4096, nullptr, 5, nullptr);
-	*/
+	// remember the lease, so the next boot does not wait for DHCP
+	if (network.source == NETWORK_SOURCE_DHCP) {
+		network.store(NETWORK_SOURCE_LEASE, &event->ip_info);
+	}
+
+	if (!network.ready) {
+		network.ready = true;
+		boot.mark("network", BOOT_NETWORK_READY);
+	}
+}
+
+// link state callback
+static void onLinkChange(
+	void *arg,
+	esp_event_base_t event_base,
+	int32_t event_id,
+	void *event_data
+) {
+	if (event_id == ETHERNET_EVENT_CONNECTED) {
+		boot.mark("link");
+
+		if (network.source == NETWORK_SOURCE_DHCP) {
+			return;
+		}
+
+		// stored addresses are usable as soon as the link is up
+		ESP_ERROR_CHECK(esp_netif_set_ip_info(network.interface, &network.stored));
+		network.address = network.stored.ip;
+
+		ESP_LOGI(TAG, "address reused: " IPSTR, IP2STR(&network.address));
+
+		if (!network.ready) {
+			network.ready = true;
+			boot.mark("network", BOOT_NETWORK_READY);
+		}
+	}
+
+	if (event_id == ETHERNET_EVENT_DISCONNECTED) {
+		ESP_LOGI(TAG, "link lost");
+		network.ready = false;
+
+		// the port may have moved, the lease task hands over to DHCP before the next link up
+		if (network.source == NETWORK_SOURCE_LEASE) {
+			xTaskNotifyGive(network.leaseTask);
+		}
+	}
 }
 
 // shared instance definition
 Network network;
 
+bool Network::load() {
+	nvs_handle_t storage;
+
+	if (nvs_open(NETWORK_STORAGE, NVS_READONLY, &storage) != ESP_OK) {
+		return false;
+	}
+
+	uint8_t source = NETWORK_SOURCE_DHCP;
+
+	bool found =
+		nvs_get_u8(storage, "source", &source) == ESP_OK &&
+		nvs_get_u32(storage, "ip", &this->stored.ip.addr) == ESP_OK &&
+		nvs_get_u32(storage, "netmask", &this->stored.netmask.addr) == ESP_OK &&
+		nvs_get_u32(storage, "gateway", &this->stored.gw.addr) == ESP_OK;
+
+	nvs_close(storage);
+
+	if (!found || source == NETWORK_SOURCE_DHCP || this->stored.ip.addr == 0) {
+		return false;
+	}
+
+	this->source = (network_source_t)source;
+
+	return true;
+}
+
+void Network::store(network_source_t source, const esp_netif_ip_info_t *info) {
+	nvs_handle_t storage;
+
+	if (nvs_open(NETWORK_STORAGE, NVS_READWRITE, &storage) != ESP_OK) {
+		ESP_LOGE(TAG, "storage unavailable");
+
+		return;
+	}
+
+	nvs_set_u8(storage, "source", source);
+	nvs_set_u32(storage, "ip", info->ip.addr);
+	nvs_set_u32(storage, "netmask", info->netmask.addr);
+	nvs_set_u32(storage, "gateway", info->gw.addr);
+
+	ESP_ERROR_CHECK_WITHOUT_ABORT(nvs_commit(storage));
+	nvs_close(storage);
+}
+
+void Network::forget() {
+	nvs_handle_t storage;
+
+	if (nvs_open(NETWORK_STORAGE, NVS_READWRITE, &storage) != ESP_OK) {
+		return;
+	}
+
+	nvs_erase_all(storage);
+	nvs_commit(storage);
+	nvs_close(storage);
+}
+
+void Network::useDhcp() {
+	ESP_LOGI(TAG, "cached lease dropped, using DHCP");
+
+	this->source = NETWORK_SOURCE_DHCP;
+	this->ready = false;
+	this->forget();
+
+	// the client clears the address until the server answers
+	esp_err_t result = esp_netif_dhcpc_start(this->interface);
+
+	if (result != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STARTED) {
+		ESP_ERROR_CHECK(result);
+	}
+}
+
+static inline void dhcpPut(uint8_t *target, uint32_t value) {
+	for (int8_t index = 3; index >= 0; index--) {
+		target[index] = (uint8_t)value;
+		value >>= 8;
+	}
+}
+
+static inline uint32_t dhcpGet(const uint8_t *source) {
+	return ((uint32_t)source[0] << 24) | (source[1] << 16) | (source[2] << 8) | source[3];
+}
+
+// the message type of the answer, 0 if none arrived
+uint8_t Network::requestLease(int connection, bool renewing, uint32_t *leaseTime) {
+	uint8_t packet[DHCP_PACKET_LIMIT] = {};
+	uint8_t mac[6];
+
+	ESP_ERROR_CHECK(esp_netif_get_mac(this->interface, mac));
+
+	uint32_t transaction = esp_random();
+
+	packet[0] = 1;
+	packet[1] = 1;
+	packet[2] = sizeof(mac);
+	dhcpPut(packet + 4, transaction);
+
+	// answers are broadcast, the server may not route to the address yet
+	packet[10] = 0x80;
+
+	// a renewal names its address, INIT-REBOOT asks for it in an option
+	if (renewing) {
+		memcpy(packet + 12, &this->stored.ip.addr, 4);
+	}
+
+	memcpy(packet + 28, mac, sizeof(mac));
+	dhcpPut(packet + DHCP_HEADER_SIZE, DHCP_COOKIE);
+
+	uint8_t *option = packet + DHCP_HEADER_SIZE + 4;
+
+	*option++ = DHCP_OPTION_TYPE;
+	*option++ = 1;
+	*option++ = DHCP_REQUEST;
+
+	if (!renewing) {
+		*option++ = DHCP_OPTION_REQUESTED;
+		*option++ = 4;
+		memcpy(option, &this->stored.ip.addr, 4);
+		option += 4;
+	}
+
+	*option++ = DHCP_OPTION_CLIENT;
+	*option++ = 1 + sizeof(mac);
+	*option++ = 1;
+	memcpy(option, mac, sizeof(mac));
+	option += sizeof(mac);
+
+	*option++ = DHCP_OPTION_PARAMETERS;
+	*option++ = 3;
+	*option++ = DHCP_OPTION_MASK;
+	*option++ = DHCP_OPTION_ROUTER;
+	*option++ = DHCP_OPTION_LEASE;
+
+	*option++ = DHCP_OPTION_END;
+
+	struct sockaddr_in server = {};
+	server.sin_family = AF_INET;
+	server.sin_port = htons(DHCP_SERVER_PORT);
+	server.sin_addr.s_addr = htonl(INADDR_BROADCAST);
+
+	if (sendto(connection, packet, option - packet, 0, (struct sockaddr *)&server, sizeof(server)) < 0) {
+		return 0;
+	}
+
+	// other clients' answers are broadcast too, skip them until the timeout
+	while (true) {
+		ssize_t length = recv(connection, packet, sizeof(packet), 0);
+
+		if (length < 0) {
+			return 0;
+		}
+
+		if (
+			length < DHCP_HEADER_SIZE + 4 ||
+			packet[0] != 2 ||
+			dhcpGet(packet + 4) != transaction ||
+			memcmp(packet + 28, mac, sizeof(mac)) != 0 ||
+			dhcpGet(packet + DHCP_HEADER_SIZE) != DHCP_COOKIE
+		) {
+			continue;
+		}
+
+		uint8_t type = 0;
+		esp_netif_ip_info_t info = this->stored;
+
+		*leaseTime = 0;
+
+		for (ssize_t index = DHCP_HEADER_SIZE + 4; index < length && packet[index] != DHCP_OPTION_END;) {
+			uint8_t code = packet[index];
+
+			// padding has no length
+			if (code == 0) {
+				index++;
+
+				continue;
+			}
+
+			if (index + 2 > length || index + 2 + packet[index + 1] > length) {
+				break;
+			}
+
+			uint8_t size = packet[index + 1];
+			const uint8_t *value = packet + index + 2;
+
+			if (code == DHCP_OPTION_TYPE && size == 1) {
+				type = value[0];
+			} else if (code == DHCP_OPTION_LEASE && size == 4) {
+				*leaseTime = dhcpGet(value);
+			} else if (code == DHCP_OPTION_MASK && size == 4) {
+				memcpy(&info.netmask.addr, value, 4);
+			} else if (code == DHCP_OPTION_ROUTER && size >= 4) {
+				memcpy(&info.gw.addr, value, 4);
+			}
+
+			index += 2 + size;
+		}
+
+		// an acknowledgement for another address is as good as a refusal
+		if (type == DHCP_ACK && memcmp(packet + 16, &this->stored.ip.addr, 4) != 0) {
+			return DHCP_NAK;
+		}
+
+		if (type == DHCP_ACK) {
+			this->stored = info;
+			this->store(NETWORK_SOURCE_LEASE, &info);
+		}
+
+		return type;
+	}
+}
+
+// one round of attempts on a socket that is closed again, the DHCP client needs the port
+uint8_t Network::exchangeLease(bool renewing, uint32_t *leaseTime) {
+	int connection = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(DHCP_CLIENT_PORT);
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	int enable = 1;
+
+	if (
+		connection < 0 ||
+		setsockopt(connection, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable)) != 0 ||
+		bind(connection, (struct sockaddr *)&address, sizeof(address)) != 0
+	) {
+		ESP_LOGE(TAG, "unable to confirm lease: errno %d", errno);
+
+		if (connection >= 0) {
+			close(connection);
+		}
+
+		return 0;
+	}
+
+	struct timeval timeout = { NETWORK_LEASE_TIMEOUT_MS / 1000, (NETWORK_LEASE_TIMEOUT_MS % 1000) * 1000 };
+	setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+	uint8_t answer = 0;
+
+	for (uint8_t attempt = 0; answer == 0 && attempt < NETWORK_LEASE_ATTEMPTS && this->ready; attempt++) {
+		answer = this->requestLease(connection, renewing, leaseTime);
+	}
+
+	close(connection);
+
+	return answer;
+}
+
+void Network::keepLease() {
+	xEventGroupWaitBits(boot.ready, BOOT_NETWORK_READY, pdFALSE, pdTRUE, portMAX_DELAY);
+
+	bool renewing = false;
+	int64_t expiry = 0;
+
+	// a notification means the link went down, the port may have moved
+	while (true) {
+		uint32_t leaseTime = 0;
+		uint8_t answer = this->exchangeLease(renewing, &leaseTime);
+
+		if (ulTaskNotifyTake(pdTRUE, 0) > 0) {
+			break;
+		}
+
+		int64_t now = esp_timer_get_time();
+
+		// without an answer to the first request nothing proves the lease
+		if (answer == DHCP_NAK || (answer != DHCP_ACK && (!renewing || now >= expiry))) {
+			break;
+		}
+
+		uint64_t delay = NETWORK_LEASE_RETRY_MS;
+
+		if (answer == DHCP_ACK) {
+			ESP_LOGI(TAG, "lease confirmed for %lu s", (unsigned long)leaseTime);
+
+			// renewed halfway through, as the DHCP client would
+			expiry = now + (int64_t)leaseTime * 1000000;
+			delay = (uint64_t)leaseTime * 500;
+			renewing = true;
+		}
+
+		uint64_t ticks = MAX(1, delay * configTICK_RATE_HZ / 1000);
+
+		if (ulTaskNotifyTake(pdTRUE, MIN(ticks, portMAX_DELAY - 1)) > 0) {
+			break;
+		}
+	}
+
+	this->useDhcp();
+
+	memory.retire();
+	vTaskDelete(NULL);
+}
+
+TASK_STORAGE(networkLease, NETWORK_LEASE_STACK_SIZE)
+
+static void networkLeaseTask(void *args) {
+	network.keepLease();
+}
+
 void Network::begin() {
 	// create network interface
 	ESP_ERROR_CHECK(esp_netif_init());
@@ -126,11 +489,45 @@ void Network::begin() {
 		nullptr
 	));
 
+	// register link callback
+	ESP_ERROR_CHECK(esp_event_handler_instance_register(
+		ETH_EVENT,
+		ESP_EVENT_ANY_ID,
+		&onLinkChange,
+		nullptr,
+		nullptr
+	));
+
 	// create interface
 	esp_netif_config_t cfg = ESP_NETIF_DEFAULT_ETH();
 	esp_netif_t *eth_netif = esp_netif_new(&cfg);
 	ESP_ERROR_CHECK(esp_netif_set_default_netif(eth_netif));
 
+	this->interface = eth_netif;
+
+	// a stored address is applied at link up without DHCP, a cached lease is confirmed with the
+	// server in the background and given up as soon as it is refused
+	if (this->load()) {
+		ESP_LOGI(
+			TAG, "using %s address " IPSTR,
+			this->source == NETWORK_SOURCE_STATIC ? "static" : "cached",
+			IP2STR(&this->stored.ip)
+		);
+
+		ESP_ERROR_CHECK(esp_netif_dhcpc_stop(eth_netif));
+
+		if (this->source == NETWORK_SOURCE_LEASE) {
+			this->leaseTask = memory.createTask(
+				networkLeaseTask,
+				"lease", "network",
+				NETWORK_LEASE_STACK_SIZE,
+				NULL,
+				2, tskNO_AFFINITY,
+				TASK_STORAGE_OF(networkLease)
+			);
+		}
+	}
+
 	eth_mac_config_t mac_config = ETH_MAC_DEFAULT_CONFIG();
 	eth_phy_config_t phy_config = ETH_PHY_DEFAULT_CONFIG();
 	eth_esp32_emac_config_t esp32_emac_config = ETH_ESP32_EMAC_DEFAULT_CONFIG();
@@ -146,11 +543,5 @@ void Network::begin() {
 	ESP_ERROR_CHECK(esp_netif_attach(eth_netif, esp_eth_new_netif_glue(eth_handle)));
 	ESP_ERROR_CHECK(esp_eth_start(eth_handle));
 
-	ESP_LOGI(TAG, "waiting for DHCP");
-
-	while (!network.ready) {
-		vTaskDelay(1);
-	}
-
-	ESP_LOGI(TAG, "ready");
+	boot.mark("ethernet");
 }
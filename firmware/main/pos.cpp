@@ -0,0 +1,347 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "record.cpp"
+
+// HID point of sale barcode scanners, usage page 0x8c
+//
+// pos/index.cpp replays recorded descriptors and reports through the parser and the decoder
+//
+// a scanner in POS mode sends the whole decoded symbol in one scanned data report,
+// longer symbols continue over several reports until the continued flag is clear
+
+#define POS_USAGE_PAGE 0x8c
+
+#define POS_USAGE_SYMBOLOGY_1 0xfb
+#define POS_USAGE_SYMBOLOGY_2 0xfc
+#define POS_USAGE_SYMBOLOGY_3 0xfd
+#define POS_USAGE_DECODED_DATA 0xfe
+#define POS_USAGE_CONTINUED 0xff
+
+#define POS_USAGE_LIMIT 16
+
+// one character past the record limit and the terminator, longer symbols reach the arena
+// one character too long and are marked as truncated there
+#define POS_SYMBOL_LIMIT (RECORD_LENGTH_LIMIT + 2)
+
+// one run of equally sized report elements
+struct PosField {
+	// bit offset within the report, after the report id
+	uint16_t offset;
+	uint8_t size;
+	uint16_t count;
+
+	uint8_t reportId;
+	bool present;
+};
+
+// where the scanned data report keeps its parts
+struct PosLayout {
+	bool found;
+
+	// 0 if the device does not use report ids
+	uint8_t reportId;
+
+	PosField symbology[3];
+	PosField data;
+	PosField continued;
+};
+
+static inline uint32_t posItemValue(const uint8_t *item, uint8_t size) {
+	uint32_t value = 0;
+
+	for (uint8_t index = 0; index < size; index++) {
+		value |= (uint32_t)item[index] << (index * 8);
+	}
+
+	return value;
+}
+
+static inline void posRecord(
+	PosLayout *layout,
+	uint32_t usage,
+	uint8_t reportId,
+	uint16_t offset,
+	uint8_t size,
+	uint16_t count
+) {
+	PosField *field = NULL;
+
+	if ((usage >> 16) != POS_USAGE_PAGE) {
+		return;
+	}
+
+	switch (usage & 0xffff) {
+		case POS_USAGE_SYMBOLOGY_1: field = &layout->symbology[0]; break;
+		case POS_USAGE_SYMBOLOGY_2: field = &layout->symbology[1]; break;
+		case POS_USAGE_SYMBOLOGY_3: field = &layout->symbology[2]; break;
+		case POS_USAGE_DECODED_DATA: field = &layout->data; break;
+		case POS_USAGE_CONTINUED: field = &layout->continued; break;
+	}
+
+	if (field == NULL || field->present) {
+		return;
+	}
+
+	field->offset = offset;
+	field->size = size;
+	field->count = count;
+	field->reportId = reportId;
+	field->present = true;
+}
+
+// finds the scanned data report in a report descriptor, false if the device is no POS scanner
+static bool posParseDescriptor(const uint8_t *descriptor, size_t length, PosLayout *layout) {
+	memset(layout, 0, sizeof(PosLayout));
+
+	// global state, including one level of push / pop
+	uint32_t usagePage = 0;
+	uint32_t reportSize = 0;
+	uint32_t reportCount = 0;
+	uint8_t reportId = 0;
+
+	uint32_t pushedPage = 0;
+	uint32_t pushedSize = 0;
+	uint32_t pushedCount = 0;
+
+	// local state, reset after every main item
+	uint32_t usages[POS_USAGE_LIMIT];
+	uint8_t usageCount = 0;
+	uint32_t usageMinimum = 0;
+	bool hasMinimum = false;
+
+	// input bits per report id, only the report holding the decoded data matters
+	uint16_t offsets[256] = {};
+
+	size_t position = 0;
+
+	while (position < length) {
+		uint8_t prefix = descriptor[position];
+
+		// long items carry no information we need
+		if (prefix == 0xfe) {
+			if (position + 1 >= length) {
+				break;
+			}
+
+			position += 3 + descriptor[position + 1];
+
+			continue;
+		}
+
+		uint8_t size = prefix & 0x03;
+		size = size == 3 ? 4 : size;
+
+		uint8_t type = (prefix >> 2) & 0x03;
+		uint8_t tag = prefix >> 4;
+
+		if (position + 1 + size > length) {
+			break;
+		}
+
+		uint32_t value = posItemValue(descriptor + position + 1, size);
+		position += 1 + size;
+
+		// main items
+		if (type == 0) {
+			// input
+			if (tag == 0x8) {
+				bool variable = value & 0x02;
+				uint16_t offset = offsets[reportId];
+
+				// expand usage ranges into the list
+				if (hasMinimum && usageCount > 0) {
+					uint32_t maximum = usages[--usageCount];
+
+					for (uint32_t usage = usageMinimum; usage <= maximum && usageCount < POS_USAGE_LIMIT; usage++) {
+						usages[usageCount++] = usage;
+					}
+				}
+
+				if (!variable || usageCount <= 1) {
+					// arrays and buffered bytes: the whole item is one field
+					if (usageCount > 0) {
+						posRecord(layout, usages[0], reportId, offset, reportSize, reportCount);
+					}
+				} else {
+					for (uint32_t element = 0; element < reportCount; element++) {
+						uint32_t usage = usages[element < usageCount ? element : usageCount - 1];
+
+						posRecord(layout, usage, reportId, offset + element * reportSize, reportSize, 1);
+					}
+				}
+
+				if (layout->data.present && !layout->found) {
+					layout->found = true;
+					layout->reportId = reportId;
+				}
+
+				offsets[reportId] += reportSize * reportCount;
+			}
+
+			usageCount = 0;
+			hasMinimum = false;
+
+			continue;
+		}
+
+		// global items
+		if (type == 1) {
+			switch (tag) {
+				case 0x0: usagePage = value; break;
+				case 0x7: reportSize = value; break;
+				case 0x8: reportId = value; break;
+				case 0x9: reportCount = value; break;
+
+				case 0xa:
+					pushedPage = usagePage;
+					pushedSize = reportSize;
+					pushedCount = reportCount;
+					break;
+
+				case 0xb:
+					usagePage = pushedPage;
+					reportSize = pushedSize;
+					reportCount = pushedCount;
+					break;
+			}
+
+			continue;
+		}
+
+		// local items, short usages take the current page
+		if (type == 2) {
+			uint32_t usage = size == 4 ? value : (usagePage << 16) | value;
+
+			if (tag == 0x0 && usageCount < POS_USAGE_LIMIT) {
+				usages[usageCount++] = usage;
+			}
+
+			if (tag == 0x1) {
+				usageMinimum = usage;
+				hasMinimum = true;
+			}
+
+			if (tag == 0x2 && usageCount < POS_USAGE_LIMIT) {
+				usages[usageCount++] = usage;
+			}
+		}
+	}
+
+	// fields of other reports than the data report are not usable
+	for (uint8_t index = 0; index < 3; index++) {
+		layout->symbology[index].present &= layout->symbology[index].reportId == layout->reportId;
+	}
+
+	layout->continued.present &= layout->continued.reportId == layout->reportId;
+
+	return layout->found;
+}
+
+static inline uint32_t posReadBits(const uint8_t *report, size_t length, uint32_t offset, uint8_t size) {
+	uint32_t value = 0;
+
+	for (uint8_t bit = 0; bit < size && bit < 32; bit++) {
+		uint32_t position = offset + bit;
+
+		if (position / 8 >= length) {
+			break;
+		}
+
+		value |= (uint32_t)((report[position / 8] >> (position % 8)) & 1) << bit;
+	}
+
+	return value;
+}
+
+// assembles complete symbols from scanned data reports
+class PosDecoder {
+	public:
+		PosLayout layout;
+
+		char symbol[POS_SYMBOL_LIMIT];
+		uint16_t length = 0;
+
+		// AIM symbology identifier, such as "]C1"
+		char symbology[4] = {};
+
+		// symbols longer than the buffer, cut off
+		uint32_t truncated = 0;
+
+		// true once a report completes a symbol
+		bool feed(const uint8_t *report, size_t reportLength);
+
+	private:
+		bool continuing = false;
+		bool overflowed = false;
+};
+
+bool PosDecoder::feed(const uint8_t *report, size_t reportLength) {
+	if (!this->layout.found) {
+		return false;
+	}
+
+	// skip the report id, offsets are relative to the payload
+	if (this->layout.reportId != 0) {
+		if (reportLength == 0 || report[0] != this->layout.reportId) {
+			return false;
+		}
+
+		report++;
+		reportLength--;
+	}
+
+	if (!this->continuing) {
+		this->length = 0;
+		this->overflowed = false;
+
+		for (uint8_t index = 0; index < 3; index++) {
+			const PosField *field = &this->layout.symbology[index];
+
+			this->symbology[index] = field->present ?
+				(char)posReadBits(report, reportLength, field->offset, field->size) :
+				0;
+		}
+
+		this->symbology[3] = '\0';
+	}
+
+	const PosField *data = &this->layout.data;
+	uint16_t received = 0;
+
+	for (uint16_t index = 0; index < data->count; index++) {
+		char character = posReadBits(report, reportLength, data->offset + index * data->size, data->size);
+
+		// the data field is zero padded
+		if (character == '\0') {
+			break;
+		}
+
+		if (this->length + received < POS_SYMBOL_LIMIT - 1) {
+			this->symbol[this->length + received] = character;
+			received++;
+		} else {
+			this->overflowed = true;
+		}
+	}
+
+	this->length += received;
+	this->symbol[this->length] = '\0';
+
+	this->continuing =
+		this->layout.continued.present &&
+		posReadBits(report, reportLength, this->layout.continued.offset, this->layout.continued.size) != 0;
+
+	if (this->continuing || this->length == 0) {
+		return false;
+	}
+
+	if (this->overflowed) {
+		this->truncated++;
+	}
+
+	return true;
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/param.h>
+#include <sys/socket.h>
+
+// metrics in the prometheus text format
+//
+// the exporter task takes a snapshot of the station counters and this formats and sends it,
+// exporter/index.cpp serves it on the host and checks the format and the scrape cost
+
+// histogram bucket n counts observations up to 2^n microseconds, as its le label says
+#define HISTOGRAM_BUCKETS 20
+
+// longest response body, the widest possible values take about 8.5 KB
+#define METRICS_BODY_LIMIT 10240
+
+// heap capabilities reported, in this order
+#define METRICS_HEAP_CAPABILITIES 3
+
+struct HistogramSnapshot {
+	uint32_t buckets[HISTOGRAM_BUCKETS];
+
+	// microseconds, a 32 bit sum would wrap after 71 minutes of observed time
+	uint64_t sum;
+};
+
+static inline uint8_t histogramBucket(uint32_t microseconds) {
+	uint8_t bucket = 0;
+
+	while (bucket < HISTOGRAM_BUCKETS - 1 && microseconds > (1u << bucket)) {
+		bucket++;
+	}
+
+	return bucket;
+}
+
+// everything one scrape reports, read at once
+struct MetricsSnapshot {
+	uint32_t scansDecoded;
+	uint32_t scansDropped;
+	uint32_t scansTruncated;
+	uint32_t scansRendered;
+
+	uint32_t scanQueue;
+	uint32_t uplinkQueue;
+	uint32_t lookupQueue;
+
+	uint32_t arenaUsed;
+
+	HistogramSnapshot renderTime;
+	HistogramSnapshot transferTime;
+
+	uint32_t displayTransfers;
+	uint32_t displayBytes;
+
+	uint32_t uplinkBatches;
+	uint32_t uplinkScans;
+	uint32_t uplinkBytes;
+	uint32_t uplinkDropped;
+
+	uint32_t lookupHits;
+	uint32_t lookupMisses;
+	uint32_t lookupTimeouts;
+
+	HistogramSnapshot lookupAnswerTime;
+	HistogramSnapshot lookupDisplayTime;
+
+	// internal, dma, spiram
+	uint32_t heapFree[METRICS_HEAP_CAPABILITIES];
+	uint32_t heapLargestBlock[METRICS_HEAP_CAPABILITIES];
+
+	bool clockSynced;
+	int64_t clockOffset;
+	int64_t clockDrift;
+	int64_t clockDelay;
+	uint32_t clockSamples;
+	uint32_t clockRejected;
+	uint32_t clockTimeouts;
+
+	bool linkUp;
+	int64_t uptime;
+	uint32_t lastScrape;
+};
+
+static const char *metricsHeapLabels[METRICS_HEAP_CAPABILITIES] = {
+	"{capability=\"internal\"}",
+	"{capability=\"dma\"}",
+	"{capability=\"spiram\"}"
+};
+
+class MetricsBody {
+	public:
+		char body[METRICS_BODY_LIMIT];
+		size_t length = 0;
+
+		// the body did not fit, the scrape is cut off
+		bool truncated = false;
+
+		void format(const MetricsSnapshot *snapshot);
+
+		// status line, headers and body, the caller closes the connection
+		void send(int client) const;
+
+	private:
+		void write(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+		void counter(const char *name, const char *help, uint32_t value);
+		void gauge(const char *name, const char *help, const char *labels, int64_t value);
+		void histogram(const char *name, const char *help, const HistogramSnapshot *histogram);
+};
+
+void MetricsBody::write(const char *format, ...) {
+	if (this->length >= METRICS_BODY_LIMIT) {
+		this->truncated = true;
+
+		return;
+	}
+
+	va_list arguments;
+	va_start(arguments, format);
+
+	int written = vsnprintf(this->body + this->length, METRICS_BODY_LIMIT - this->length, format, arguments);
+
+	va_end(arguments);
+
+	if (written > 0) {
+		this->truncated = this->truncated || this->length + written >= METRICS_BODY_LIMIT;
+		this->length = MIN(this->length + written, METRICS_BODY_LIMIT);
+	}
+}
+
+void MetricsBody::counter(const char *name, const char *help, uint32_t value) {
+	this->write("# HELP %s %s\n# TYPE %s counter\n%s %" PRIu32 "\n", name, help, name, name, value);
+}
+
+// labels are written as is, an empty string for none
+void MetricsBody::gauge(const char *name, const char *help, const char *labels, int64_t value) {
+	if (help) {
+		this->write("# HELP %s %s\n# TYPE %s gauge\n", name, help, name);
+	}
+
+	this->write("%s%s %" PRId64 "\n", name, labels, value);
+}
+
+void MetricsBody::histogram(const char *name, const char *help, const HistogramSnapshot *histogram) {
+	this->write("# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+
+	uint32_t cumulative = 0;
+
+	for (uint8_t bucket = 0; bucket < HISTOGRAM_BUCKETS - 1; bucket++) {
+		cumulative += histogram->buckets[bucket];
+
+		this->write("%s_bucket{le=\"%g\"} %" PRIu32 "\n", name, (double)(1u << bucket) / 1e6, cumulative);
+	}
+
+	cumulative += histogram->buckets[HISTOGRAM_BUCKETS - 1];
+
+	this->write("%s_bucket{le=\"+Inf\"} %" PRIu32 "\n", name, cumulative);
+	this->write("%s_sum %g\n", name, histogram->sum / 1e6);
+	this->write("%s_count %" PRIu32 "\n", name, cumulative);
+}
+
+void MetricsBody::format(const MetricsSnapshot *snapshot) {
+	this->length = 0;
+	this->truncated = false;
+
+	this->counter("tag_scans_decoded_total", "Scans completed by a scanner.", snapshot->scansDecoded);
+	this->counter("tag_scans_dropped_total", "Scans lost before reaching the main loop.", snapshot->scansDropped);
+	this->counter("tag_scans_truncated_total", "Scans cut off at the record length limit.", snapshot->scansTruncated);
+	this->counter("tag_scans_rendered_total", "Scans shown on the display.", snapshot->scansRendered);
+
+	this->gauge("tag_queue_depth", "Items waiting in a queue.", "{queue=\"scan\"}", snapshot->scanQueue);
+	this->gauge("tag_queue_depth", NULL, "{queue=\"uplink\"}", snapshot->uplinkQueue);
+	this->gauge("tag_queue_depth", NULL, "{queue=\"lookup\"}", snapshot->lookupQueue);
+
+	this->gauge("tag_record_arena_used_bytes", "Bytes held by unreleased scan records.", "", snapshot->arenaUsed);
+
+	this->histogram("tag_render_seconds", "Time to draw a frame.", &snapshot->renderTime);
+	this->histogram("tag_transfer_seconds", "Time to push a frame to the panel.", &snapshot->transferTime);
+
+	this->counter("tag_display_transfers_total", "Frames pushed to the panel.", snapshot->displayTransfers);
+	this->counter("tag_display_bytes_total", "Pixel bytes pushed to the panel.", snapshot->displayBytes);
+
+	this->counter("tag_uplink_batches_total", "Batches sent to the collector.", snapshot->uplinkBatches);
+	this->counter("tag_uplink_scans_total", "Scans sent to the collector.", snapshot->uplinkScans);
+	this->counter("tag_uplink_bytes_total", "Batch bytes sent to the collector.", snapshot->uplinkBytes);
+	this->counter("tag_uplink_dropped_total", "Scans not delivered to the collector.", snapshot->uplinkDropped);
+
+	this->counter("tag_lookup_hits_total", "Lookups answered from the cache.", snapshot->lookupHits);
+	this->counter("tag_lookup_misses_total", "Lookups sent to the server.", snapshot->lookupMisses);
+	this->counter("tag_lookup_timeouts_total", "Lookups without an answer.", snapshot->lookupTimeouts);
+
+	this->histogram("tag_lookup_answer_seconds", "Time from lookup request to server answer.", &snapshot->lookupAnswerTime);
+	this->histogram("tag_lookup_display_seconds", "Time from scan to its lookup answer on the panel.", &snapshot->lookupDisplayTime);
+
+	for (uint8_t capability = 0; capability < METRICS_HEAP_CAPABILITIES; capability++) {
+		this->gauge(
+			"tag_heap_free_bytes",
+			capability == 0 ? "Free heap per capability." : NULL,
+			metricsHeapLabels[capability],
+			snapshot->heapFree[capability]
+		);
+	}
+
+	for (uint8_t capability = 0; capability < METRICS_HEAP_CAPABILITIES; capability++) {
+		this->gauge(
+			"tag_heap_largest_block_bytes",
+			capability == 0 ? "Largest free block per capability." : NULL,
+			metricsHeapLabels[capability],
+			snapshot->heapLargestBlock[capability]
+		);
+	}
+
+	this->gauge("tag_clock_synced", "Scan times are collector time.", "", snapshot->clockSynced);
+	this->gauge("tag_clock_offset_microseconds", "Collector time minus local time.", "", snapshot->clockOffset);
+	this->gauge("tag_clock_drift_ppb", "Local clock drift against the collector.", "", snapshot->clockDrift);
+	this->gauge("tag_clock_delay_microseconds", "Round trip delay of the last time exchange.", "", snapshot->clockDelay);
+	this->counter("tag_clock_samples_total", "Time exchanges answered.", snapshot->clockSamples);
+	this->counter("tag_clock_rejected_total", "Time exchanges dropped for their delay.", snapshot->clockRejected);
+	this->counter("tag_clock_timeouts_total", "Time exchanges without an answer.", snapshot->clockTimeouts);
+
+	this->gauge("tag_link_up", "Ethernet link with an address.", "", snapshot->linkUp);
+	this->gauge("tag_uptime_seconds", "Time since boot.", "", snapshot->uptime);
+	this->gauge("tag_scrape_microseconds", "Duration of the previous scrape.", "", snapshot->lastScrape);
+}
+
+void MetricsBody::send(int client) const {
+	const char *header =
+		"HTTP/1.0 200 OK\r\n"
+		"Content-Type: text/plain; version=0.0.4\r\n"
+		"Connection: close\r\n"
+		"\r\n";
+
+	::send(client, header, strlen(header), 0);
+	::send(client, this->body, this->length, 0);
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// scan records, stored once and shared by every consumer
+//
+// records are bump allocated from a ring by a single producer, consumers hold references
+// and release them in any order, space is reclaimed once the oldest records are released
+
+// longest scan, longer scans are cut off
+#define RECORD_LENGTH_LIMIT 256
+
+// ring of the station scans, shared by the display and the uplink
+#define RECORD_ARENA_SIZE 16384
+
+#define RECORD_ALIGNMENT 8
+
+struct ScanRecord {
+	// bytes taken in the arena, including header and padding
+	uint32_t size;
+
+	uint16_t length;
+	std::atomic<uint8_t> references;
+
+	// AIM symbology identifier, empty for keyboard scanners
+	char symbology[4];
+
+	// tag family + 1 as classified by the producer before the record is shared, 0 if unknown
+	uint8_t family;
+
+	// the scan was longer than RECORD_LENGTH_LIMIT, only its start is stored
+	bool truncated;
+
+	// scan completion, local microseconds, wraps, only for durations, set by the producer
+	uint32_t completed;
+
+	// scan completion, collector time in microseconds, time since boot before the first sync
+	uint64_t time;
+
+	// the scan follows the header, always terminated
+	char *data() {
+		return (char *)(this + 1);
+	}
+
+	const char *data() const {
+		return (const char *)(this + 1);
+	}
+};
+
+static inline uint32_t recordSize(uint32_t length) {
+	uint32_t size = sizeof(ScanRecord) + length + 1;
+
+	return (size + RECORD_ALIGNMENT - 1) & ~(uint32_t)(RECORD_ALIGNMENT - 1);
+}
+
+// consumers call this once they are done with a record
+static inline void recordRelease(ScanRecord *record) {
+	record->references.fetch_sub(1, std::memory_order_release);
+}
+
+class RecordArena {
+	public:
+		// accounting, written by the producer
+		uint32_t committed = 0;
+		uint32_t overflow = 0;
+		uint32_t truncated = 0;
+
+		// memory has to be aligned to RECORD_ALIGNMENT, only a power of two of it is used
+		void begin(uint8_t *memory, uint32_t size);
+
+		// stores a scan for the given number of consumers, NULL if the arena is full
+		ScanRecord *commit(
+			const char *data,
+			uint32_t length,
+			const char *symbology,
+			uint64_t time,
+			uint8_t references
+		);
+
+		// bytes held by records not yet reclaimed
+		uint32_t used() const {
+			return this->head - this->tail;
+		}
+
+	private:
+		uint8_t *memory = NULL;
+		uint32_t size = 0;
+
+		// running positions, the index is position % size
+		uint32_t head = 0;
+		uint32_t tail = 0;
+
+		ScanRecord *at(uint32_t position) {
+			return (ScanRecord *)(this->memory + position % this->size);
+		}
+
+		void reclaim();
+};
+
+void RecordArena::begin(uint8_t *memory, uint32_t size) {
+	this->memory = memory;
+
+	// positions keep counting across the 32 bit wrap only for powers of two
+	this->size = 1;
+
+	while (this->size * 2 <= size) {
+		this->size *= 2;
+	}
+
+	this->head = 0;
+	this->tail = 0;
+}
+
+void RecordArena::reclaim() {
+	while (this->tail != this->head) {
+		ScanRecord *record = this->at(this->tail);
+
+		if (record->references.load(std::memory_order_acquire) != 0) {
+			break;
+		}
+
+		this->tail += record->size;
+	}
+}
+
+ScanRecord *RecordArena::commit(
+	const char *data,
+	uint32_t length,
+	const char *symbology,
+	uint64_t time,
+	uint8_t references
+) {
+	bool truncated = length > RECORD_LENGTH_LIMIT;
+
+	if (truncated) {
+		length = RECORD_LENGTH_LIMIT;
+		this->truncated++;
+	}
+
+	uint32_t needed = recordSize(length);
+	this->reclaim();
+
+	// records never wrap, the rest of the ring is skipped instead
+	uint32_t index = this->head % this->size;
+	uint32_t skip = this->size - index < needed ? this->size - index : 0;
+
+	if (needed + skip > this->size - this->used()) {
+		this->overflow++;
+
+		return NULL;
+	}
+
+	// padding only uses the first header fields, which fit into the alignment
+	if (skip) {
+		ScanRecord *padding = this->at(this->head);
+
+		padding->size = skip;
+		padding->references.store(0, std::memory_order_relaxed);
+
+		this->head += skip;
+	}
+
+	ScanRecord *record = this->at(this->head);
+
+	record->size = needed;
+	record->length = length;
+	record->family = 0;
+	record->truncated = truncated;
+	record->time = time;
+
+	memset(record->symbology, 0, sizeof(record->symbology));
+	strncpy(record->symbology, symbology, sizeof(record->symbology) - 1);
+
+	memcpy(record->data(), data, length);
+	record->data()[length] = '\0';
+
+	record->references.store(references, std::memory_order_release);
+
+	this->head += needed;
+	this->committed++;
+
+	return record;
+}
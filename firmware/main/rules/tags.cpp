@@ -0,0 +1,97 @@
+#pragma once
+
+#include "classify.cpp"
+
+// generated by /rules/index.cpp from tags.rules
+//
+// 6 rules, 67 states, 12 character classes
+//
+static const TagFamily tagFamilies[] = {
+	{ "pallet", 0xfd00, TAG_PRIORITY_HIGH },
+	{ "parcel", 0x065f, TAG_PRIORITY_NORMAL },
+	{ "tote", 0x7fef, TAG_PRIORITY_NORMAL },
+	{ "badge", 0xf81f, TAG_PRIORITY_LOW },
+};
+
+static const uint8_t tagClasses[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 6, 0, 0, 7, 0, 8,
+	9, 0, 0, 0, 10, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 6, 0, 0, 7, 0, 8,
+	9, 0, 0, 0, 10, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t tagTransitions[] = {
+	1, 2, 3, 1, 1, 4, 5, 1, 1, 1, 6, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8,
+	1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 10, 1, 1, 1, 1, 1, 1, 11, 11, 11, 1, 1, 1, 1,
+	12, 1, 1, 1, 1, 13, 13, 13, 1, 1, 1, 1, 1, 1, 1, 1,
+	14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 15, 1, 1, 1, 1, 1, 1, 16, 1, 1, 1,
+	1, 1, 1, 1, 1, 17, 17, 17, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 18, 1, 1, 19, 19, 19,
+	1, 1, 1, 1, 1, 1, 1, 1, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 1, 21, 21, 21, 1, 1, 1, 1, 1, 1, 1, 1,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 1, 22, 22, 22,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 23, 1, 1,
+	1, 1, 1, 1, 1, 24, 24, 24, 1, 1, 1, 1, 1, 1, 1, 1,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 1, 26, 26, 26,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 27, 27, 27, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 28, 28, 28, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 29, 29, 29, 1, 1, 1, 1, 1, 1, 1, 1, 30, 30, 30, 30,
+	30, 30, 30, 30, 30, 30, 30, 30, 1, 31, 31, 31, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 32, 32, 32, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 33, 33, 33, 1, 1, 1, 1, 1, 1, 1, 1, 1, 34, 34, 34,
+	1, 1, 1, 1, 1, 1, 1, 1, 35, 35, 35, 35, 35, 35, 35, 35,
+	35, 35, 35, 35, 1, 36, 36, 36, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 37, 37, 37, 1, 1, 1, 1, 1, 1, 1, 1, 1, 38, 38, 38,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 39, 39, 39, 1, 1, 1, 1,
+	1, 1, 1, 1, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+	1, 41, 41, 41, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 42, 42, 42, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 43, 43, 43, 1, 1, 1, 1, 1, 1, 1, 1,
+	44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 45, 45, 45, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 46, 46, 46, 1, 1, 1, 1, 1, 1, 1, 1,
+	47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 1, 48, 48, 48,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 49, 49, 49, 1, 1, 1, 1,
+	1, 1, 1, 1, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 51, 51, 51,
+	1, 1, 1, 1, 1, 1, 1, 1, 52, 52, 52, 52, 52, 52, 52, 52,
+	52, 52, 52, 52, 1, 53, 53, 53, 1, 1, 1, 1, 1, 1, 1, 1,
+	54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 1, 55, 55, 55,
+	1, 1, 1, 1, 1, 1, 1, 1, 56, 56, 56, 56, 56, 56, 56, 56,
+	56, 56, 56, 56, 1, 57, 57, 57, 1, 1, 1, 1, 1, 1, 1, 1,
+	58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 1, 59, 59, 59,
+	1, 1, 1, 1, 1, 1, 1, 1, 60, 60, 60, 60, 60, 60, 60, 60,
+	60, 60, 60, 60, 1, 61, 61, 61, 1, 1, 1, 1, 1, 1, 1, 1,
+	62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 1, 63, 63, 63,
+	1, 1, 1, 1, 1, 1, 1, 1, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 1, 65, 65, 65, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 66, 66, 66,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1,
+};
+
+static const uint8_t tagResults[] = {
+	0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 1,
+};
+
+static const TagTable tagRules = { tagFamilies, 4, tagClasses, 12, tagTransitions, tagResults, 67 };
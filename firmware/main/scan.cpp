@@ -1,6 +1,9 @@
+#pragma once
+
 #include <stdio.h>
 #include <stdbool.h>
 #include <string.h>
+#include <sys/param.h>
 #include <unistd.h>
 
 extern "C" {
@@ -10,6 +13,7 @@ extern "C" {
 	#include "freertos/queue.h"
 	#include "esp_err.h"
 	#include "esp_log.h"
+	#include "esp_timer.h"
 	#include "usb/usb_host.h"
 	#include "errno.h"
 	#include "driver/gpio.h"
@@ -19,13 +23,69 @@ extern "C" {
 	#include "usb/hid_usage_mouse.h"
 }
 
-#define MAX_SCAN_LENGTH 10
+#include "boot.cpp"
+#include "clock.cpp"
+#include "memory.cpp"
+#include "pos.cpp"
+#include "wedge.cpp"
+#include "record.cpp"
+#include "metrics.cpp"
+#include "rules/tags.cpp"
+#include "trace.cpp"
+
+#define SCAN_QUEUE_LENGTH 16
+
+// every record is released by the main loop (display and log) and the uplink
+#define SCAN_CONSUMERS 2
+
+#define SCANNER_STACK_SIZE 4096
+#define USB_EVENTS_STACK_SIZE 4096
+#define HID_STACK_SIZE 4096
+
+#define APP_EVENT_QUEUE_LENGTH 10
+
+// prints descriptors, reports and decoded symbols in the trace format of pos/index.cpp, to
+// record traces from real scanners
+#ifndef SCAN_CAPTURE
+#define SCAN_CAPTURE 0
+#endif
+
+// keyboard scans in progress
+static WedgeDecoder wedgeDecoder;
+
+// completed scans, receives ScanRecord pointers
+QueueHandle_t scanQueue = NULL;
+
+RecordArena scanArena;
+alignas(RECORD_ALIGNMENT) static uint8_t scanArenaMemory[RECORD_ARENA_SIZE];
+
+QUEUE_STORAGE(scan, SCAN_QUEUE_LENGTH, ScanRecord *)
 
-char scanBuffer[MAX_SCAN_LENGTH];
-int scanIndex = 0;
+#define POS_DEVICE_LIMIT 4
 
-char scan[MAX_SCAN_LENGTH];
-bool scanReady = false;
+// scanners that report whole symbols on the POS usage page
+struct PosDevice {
+	hid_host_device_handle_t handle;
+	PosDecoder decoder;
+};
+
+static PosDevice posDevices[POS_DEVICE_LIMIT];
+
+#if SCAN_CAPTURE
+static void captureBytes(const char *item, int64_t time, const uint8_t *data, size_t length) {
+	printf("%s ", item);
+
+	if (time >= 0) {
+		printf("%lld ", (long long)time);
+	}
+
+	for (size_t index = 0; index < length; index++) {
+		printf("%02x", data[index]);
+	}
+
+	printf("\n");
+}
+#endif
 
 typedef enum {
 	APP_EVENT = 0,
@@ -43,117 +103,53 @@ typedef struct {
 	} hid_host_device;
 } app_event_queue_t;
 
-typedef enum {
-	KEY_STATE_PRESSED = 0x00,
-	KEY_STATE_RELEASED = 0x01
-} key_state_t;
-
-typedef struct {
-	key_state_t state;
-	uint8_t modifier;
-	uint8_t key_code;
-} key_event_t;
-
-static void key_event_callback(key_event_t *key_event) {
-	ESP_LOGI("SCAN", "hit %x", key_event->key_code);
-
-	if (key_event->state == KEY_STATE_PRESSED) {
-		return;
-	}
-
-	if (scanReady) {
+static void scanComplete(const char *data, uint32_t length, const char *symbology) {
+	if (length == 0) {
 		return;
 	}
 
-	// end read character
-	//
-	// enter / tab / space
-	if (key_event->key_code == 40 || key_event->key_code == 43 || key_event->key_code == 44) {
-		memcpy(scan, scanBuffer, scanIndex);
-		scan[scanIndex] = '\0';
+	TRACE_BEGIN(TRACE_MARK_SCAN);
 
-		scanReady = true;
-		scanIndex = 0;
-	}
+	// the arena counts overflow and truncation
+	ScanRecord *record = scanArena.commit(
+		data, length, symbology,
+		syncedMicroseconds(),
+		SCAN_CONSUMERS
+	);
 
-	unsigned char character = 0;
+	if (record == NULL) {
+		scansDropped.add();
+		TRACE_END(TRACE_MARK_SCAN);
 
-	// zero
-	if (key_event->key_code == 39) {
-		character = '0';
-	}
-
-	// numbers
-	if (key_event->key_code >= 30 && key_event->key_code <= 38) {
-		character = '1' + (key_event->key_code - 30);
+		return;
 	}
 
-	// letters
-	char letter = key_event->key_code - 4 + 'a';
+	scansDecoded.add();
 
-	if (letter >= 'a' && letter <= 'z') {
-		character = letter;
-	}
+	record->completed = esp_timer_get_time();
 
-	if (character != 0) {
-		scanBuffer[scanIndex++] = character;
+	// one pass over the tag, before any consumer sees the record
+	record->family = classifyTag(&tagRules, record->data(), record->length);
 
-		if (scanIndex == MAX_SCAN_LENGTH) {
-			scanIndex = 0;
-		}
-	}
-}
+	if (xQueueSend(scanQueue, &record, 0) != pdTRUE) {
+		scansDropped.add();
 
-static inline bool key_found(
-	const uint8_t *const src,
-	uint8_t key,
-	unsigned int length
-) {
-	for (unsigned int i = 0; i < length; i++) {
-		if (src[i] == key) {
-			return true;
+		for (uint8_t consumer = 0; consumer < SCAN_CONSUMERS; consumer++) {
+			recordRelease(record);
 		}
 	}
 
-	return false;
+	TRACE_END(TRACE_MARK_SCAN);
 }
 
-static void hid_host_keyboard_report_callback(const uint8_t *const data, const int length) {
-	hid_keyboard_input_report_boot_t *kb_report = (hid_keyboard_input_report_boot_t *)data;
-
-	if (length < sizeof(hid_keyboard_input_report_boot_t)) {
-		return;
-	}
-
-	static uint8_t prev_keys[HID_KEYBOARD_KEY_MAX] = { 0 };
-	key_event_t key_event;
-
-	for (int i = 0; i < HID_KEYBOARD_KEY_MAX; i++) {
-		// key has been released verification
-		if (
-			prev_keys[i] > HID_KEY_ERROR_UNDEFINED &&
-			!key_found(kb_report->key, prev_keys[i], HID_KEYBOARD_KEY_MAX)
-		) {
-			key_event.key_code = prev_keys[i];
-			key_event.modifier = 0;
-			key_event.state = KEY_STATE_RELEASED;
-
-			key_event_callback(&key_event);
-		}
-
-		// key has been pressed verification
-		if (
-			kb_report->key[i] > HID_KEY_ERROR_UNDEFINED &&
-			!key_found(prev_keys, kb_report->key[i], HID_KEYBOARD_KEY_MAX)
-		) {
-			key_event.key_code = kb_report->key[i];
-			key_event.modifier = kb_report->modifier.val;
-			key_event.state = KEY_STATE_PRESSED;
-			key_event_callback(&key_event);
+static PosDevice *findPosDevice(hid_host_device_handle_t handle) {
+	for (uint8_t index = 0; index < POS_DEVICE_LIMIT; index++) {
+		if (posDevices[index].handle == handle) {
+			return &posDevices[index];
 		}
 	}
 
-	memcpy(prev_keys, &kb_report->key, HID_KEYBOARD_KEY_MAX);
+	return NULL;
 }
 
 void hid_host_interface_callback(
@@ -175,10 +171,31 @@ void hid_host_interface_callback(
 				&data_length
 			));
 
+#if SCAN_CAPTURE
+			captureBytes("report", esp_timer_get_time(), data, data_length);
+#endif
+
 			if (HID_SUBCLASS_BOOT_INTERFACE == dev_params.sub_class) {
-				if (HID_PROTOCOL_KEYBOARD == dev_params.proto) {
-					hid_host_keyboard_report_callback(data, data_length);
+				if (HID_PROTOCOL_KEYBOARD == dev_params.proto && wedgeDecoder.feed(data, data_length)) {
+#if SCAN_CAPTURE
+					printf("expect - %.*s\n", (int)MIN(wedgeDecoder.length, RECORD_LENGTH_LIMIT), wedgeDecoder.symbol);
+#endif
+
+					scanComplete(wedgeDecoder.symbol, wedgeDecoder.length, "");
 				}
+
+				break;
+			}
+
+			// whole symbols, no per key reports
+			PosDevice *device = findPosDevice(hid_device_handle);
+
+			if (device && device->decoder.feed(data, data_length)) {
+#if SCAN_CAPTURE
+				printf("expect %s %s\n", device->decoder.symbology[0] ? device->decoder.symbology : "-", device->decoder.symbol);
+#endif
+
+				scanComplete(device->decoder.symbol, device->decoder.length, device->decoder.symbology);
 			}
 
 			break;
@@ -186,6 +203,13 @@ void hid_host_interface_callback(
 
 		case HID_HOST_INTERFACE_EVENT_DISCONNECTED: {
 			ESP_LOGI("SCAN", "device disconnected");
+
+			PosDevice *device = findPosDevice(hid_device_handle);
+
+			if (device) {
+				device->handle = NULL;
+			}
+
 			ESP_ERROR_CHECK(hid_host_device_close(hid_device_handle));
 
 			break;
@@ -226,12 +250,18 @@ static void usb_lib_task(void *arg) {
 	ESP_LOGI("SCAN", "USB shutdown");
 	vTaskDelay(10); // Short delay to allow clients clean-up
 	ESP_ERROR_CHECK(usb_host_uninstall());
+
+	memory.retire();
 	vTaskDelete(NULL);
 }
 
 
 QueueHandle_t app_event_queue = NULL;
 
+TASK_STORAGE(scanner, SCANNER_STACK_SIZE)
+TASK_STORAGE(usbEvents, USB_EVENTS_STACK_SIZE)
+QUEUE_STORAGE(appEvent, APP_EVENT_QUEUE_LENGTH, app_event_queue_t)
+
 void hid_host_device_callback(
 	hid_host_device_handle_t hid_device_handle,
 	const hid_host_driver_event_t event,
@@ -273,41 +303,79 @@ void hid_host_device_event(
 
 			if (HID_PROTOCOL_KEYBOARD == dev_params.proto) {
 				ESP_ERROR_CHECK(hid_class_request_set_idle(hid_device_handle, 0, 0));
+
+#if SCAN_CAPTURE
+				printf("mode wedge\n");
+#endif
+			}
+		} else {
+			// report protocol interfaces may be POS scanners
+			size_t descriptorLength = 0;
+			const uint8_t *descriptor = hid_host_get_report_descriptor(hid_device_handle, &descriptorLength);
+
+#if SCAN_CAPTURE
+			if (descriptor) {
+				printf("mode pos\n");
+				captureBytes("descriptor", -1, descriptor, descriptorLength);
+			}
+#endif
+
+			PosDevice *device = findPosDevice(NULL);
+
+			if (device) {
+				device->decoder = PosDecoder();
+			}
+
+			if (descriptor && device && posParseDescriptor(descriptor, descriptorLength, &device->decoder.layout)) {
+				ESP_LOGI("SCAN", "POS scanner, report %d", device->decoder.layout.reportId);
+
+				device->handle = hid_device_handle;
 			}
 		}
 
 		ESP_ERROR_CHECK(hid_host_device_start(hid_device_handle));
+
+		// scans are accepted from here on
+		if (!boot.isReady(BOOT_USB_READY)) {
+			boot.mark("usb", BOOT_USB_READY);
+		}
 	}
 }
 
 void scannerTask(void *args) {
-	BaseType_t task_created;
 	app_event_queue_t evt_queue;
 
-	task_created = xTaskCreatePinnedToCore(
+	memory.createTask(
 		usb_lib_task,
-		"usb_events",
-		4096,
+		"usb_events", "scan",
+		USB_EVENTS_STACK_SIZE,
 		xTaskGetCurrentTaskHandle(),
-		2, NULL, 0
+		2, 0,
+		TASK_STORAGE_OF(usbEvents)
 	);
 
-	assert(task_created == pdTRUE);
-
 	// Wait for notification from usb_lib_task to proceed
 	ulTaskNotifyTake(false, 1000);
 
+	// exists before the driver can report a device
+	app_event_queue = memory.createQueue(
+		"scan",
+		APP_EVENT_QUEUE_LENGTH, sizeof(app_event_queue_t),
+		QUEUE_STORAGE_OF(appEvent)
+	);
+
 	hid_host_driver_config_t hid_host_driver_config = {};  // zero-initialize
 	hid_host_driver_config.create_background_task = true;
 	hid_host_driver_config.task_priority = 5;
-	hid_host_driver_config.stack_size = 4096;
+	hid_host_driver_config.stack_size = HID_STACK_SIZE;
 	hid_host_driver_config.core_id = 0;
 	hid_host_driver_config.callback = hid_host_device_callback;
 	hid_host_driver_config.callback_arg = NULL;
 
+	// the driver always allocates its background task from the heap
 	ESP_ERROR_CHECK(hid_host_install(&hid_host_driver_config));
-
-	app_event_queue = xQueueCreate(10, sizeof(app_event_queue_t));
+	memory.account("scan", HID_STACK_SIZE, false);
+	boot.mark("usb host");
 
 	while (1) {
 		// Wait queue
@@ -324,5 +392,21 @@ void scannerTask(void *args) {
 }
 
 void scannerBegin() {
-	xTaskCreate(scannerTask, "scanner", 4096, NULL, 0, NULL);
+	scanArena.begin(scanArenaMemory, sizeof(scanArenaMemory));
+	memory.account("scan", sizeof(scanArenaMemory), true);
+
+	scanQueue = memory.createQueue(
+		"scan",
+		SCAN_QUEUE_LENGTH, sizeof(ScanRecord *),
+		QUEUE_STORAGE_OF(scan)
+	);
+
+	memory.createTask(
+		scannerTask,
+		"scanner", "scan",
+		SCANNER_STACK_SIZE,
+		NULL,
+		0, tskNO_AFFINITY,
+		TASK_STORAGE_OF(scanner)
+	);
 }
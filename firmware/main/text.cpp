@@ -0,0 +1,491 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "font/index.cpp"
+
+// text layout and rendering into an RGB565 canvas
+//
+// the layout pass breaks lines and measures the bounding box, the render pass only writes
+// pixels inside the canvas, render/index.cpp checks both on the host against font data
+
+#define GLYPH_CACHE_FONTS 4
+#define GLYPH_CACHE_CHARACTERS 128
+
+#define TEXT_LINE_LIMIT 8
+
+typedef enum {
+	TEXT_ALIGN_LEFT = 0,
+	TEXT_ALIGN_CENTER,
+	TEXT_ALIGN_RIGHT
+} text_align_t;
+
+// direct character to glyph lookup, built once per font
+struct GlyphCache {
+	const Font *font;
+	const Glyph *glyphs[GLYPH_CACHE_CHARACTERS];
+};
+
+static GlyphCache glyphCaches[GLYPH_CACHE_FONTS];
+
+struct TextLine {
+	const char *start;
+	uint16_t length;
+	uint16_t width;
+};
+
+// result of the layout pass, everything the render pass needs
+struct TextLayout {
+	const Font *font;
+
+	TextLine lines[TEXT_LINE_LIMIT];
+	uint8_t lineCount;
+
+	// tight bounding box of all visible lines
+	uint16_t width;
+	uint16_t height;
+
+	// text did not fit into the line limit or the height
+	bool truncated;
+};
+
+static const Glyph *searchGlyph(const Font *font, char character) {
+	for (size_t index = 0; index < font->glyphCount; index++) {
+		if (font->glyphs[index].character == character) {
+			return &font->glyphs[index];
+		}
+	}
+
+	return NULL;
+}
+
+static const GlyphCache *findGlyphCache(const Font *font) {
+	for (size_t index = 0; index < GLYPH_CACHE_FONTS; index++) {
+		GlyphCache *cache = &glyphCaches[index];
+
+		if (cache->font == font) {
+			return cache;
+		}
+
+		if (cache->font == NULL) {
+			for (int character = 0; character < GLYPH_CACHE_CHARACTERS; character++) {
+				cache->glyphs[character] = searchGlyph(font, (char)character);
+			}
+
+			cache->font = font;
+
+			return cache;
+		}
+	}
+
+	return NULL;
+}
+
+static const Glyph *findGlyph(const Font *font, char character) {
+	const GlyphCache *cache = findGlyphCache(font);
+
+	if (cache == NULL) {
+		return searchGlyph(font, character);
+	}
+
+	if ((unsigned char)character >= GLYPH_CACHE_CHARACTERS) {
+		return NULL;
+	}
+
+	return cache->glyphs[(unsigned char)character];
+}
+
+static inline uint8_t glyphAdvance(const Font *font, const Glyph *glyph) {
+	return glyph == NULL ? font->height : glyph->width;
+}
+
+static inline uint16_t rgb(uint8_t r, uint8_t g, uint8_t b) {
+	return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+// coverage levels of anti aliased glyphs
+#define BLEND_LEVELS 16
+
+// colour pairs with a ready blend table
+#define BLEND_CACHE_SIZE 8
+
+// every coverage level blended from bg to fg, so a run of pixels costs one load
+struct BlendTable {
+	uint16_t fg;
+	uint16_t bg;
+	bool ready;
+
+	uint16_t colors[BLEND_LEVELS];
+};
+
+// only the display task draws, replaced round robin
+static BlendTable blendTables[BLEND_CACHE_SIZE];
+static uint8_t blendNext = 0;
+
+static inline uint16_t blendChannel(uint16_t fg, uint16_t bg, uint8_t level) {
+	return (fg * level + bg * (BLEND_LEVELS - 1 - level) + (BLEND_LEVELS - 1) / 2) / (BLEND_LEVELS - 1);
+}
+
+static const uint16_t *findBlend(uint16_t fg, uint16_t bg) {
+	for (size_t index = 0; index < BLEND_CACHE_SIZE; index++) {
+		BlendTable *table = &blendTables[index];
+
+		if (table->ready && table->fg == fg && table->bg == bg) {
+			return table->colors;
+		}
+	}
+
+	BlendTable *table = &blendTables[blendNext];
+	blendNext = (blendNext + 1) % BLEND_CACHE_SIZE;
+
+	// channels are blended in place, 5 bit red, 6 bit green, 5 bit blue
+	for (uint8_t level = 0; level < BLEND_LEVELS; level++) {
+		table->colors[level] =
+			(blendChannel(fg >> 11, bg >> 11, level) << 11) |
+			(blendChannel((fg >> 5) & 0x3F, (bg >> 5) & 0x3F, level) << 5) |
+			blendChannel(fg & 0x1F, bg & 0x1F, level);
+	}
+
+	table->fg = fg;
+	table->bg = bg;
+	table->ready = true;
+
+	return table->colors;
+}
+
+// writes one horizontal run, clipped to the canvas
+static inline void fillSpan(
+	uint16_t *canvas,
+	int canvasWidth,
+	int canvasHeight,
+
+	int x,
+	int y,
+	int length,
+
+	uint16_t color
+) {
+	if (y < 0 || y >= canvasHeight) {
+		return;
+	}
+
+	int end = x + length;
+
+	if (x < 0) {
+		x = 0;
+	}
+
+	if (end > canvasWidth) {
+		end = canvasWidth;
+	}
+
+	uint16_t *pixel = canvas + y * canvasWidth + x;
+
+	for (int column = x; column < end; column++) {
+		*pixel++ = color;
+	}
+}
+
+// draws an anti aliased glyph, a run has one coverage and so one colour, filled in bulk
+//
+// glyphs inside the canvas, nearly all of them, are written through one moving pointer
+// without clipping, rows and columns advance by subtraction as runs span a few rows at most
+static void drawCoverage(
+	const Glyph *glyph,
+	uint8_t height,
+
+	uint16_t *canvas,
+	int canvasWidth,
+	int canvasHeight,
+
+	int x,
+	int y,
+
+	const uint16_t *blend
+) {
+	int width = glyph->width;
+	int column = 0;
+	uint16_t runIndex = 0;
+
+	if (x >= 0 && y >= 0 && x + width <= canvasWidth && y + height <= canvasHeight) {
+		uint16_t *pixel = canvas + y * canvasWidth + x;
+		int stride = canvasWidth - width;
+
+		while (runIndex < glyph->coverageCount) {
+			uint8_t level;
+			int length = glyphRun(glyph, &runIndex, &level);
+
+			if (level == 0) {
+				column += length;
+				pixel += length;
+
+				while (column >= width) {
+					column -= width;
+					pixel += stride;
+				}
+
+				continue;
+			}
+
+			uint16_t color = blend[level];
+
+			// most edge runs are a single pixel
+			if (length == 1) {
+				*pixel++ = color;
+
+				if (++column == width) {
+					column = 0;
+					pixel += stride;
+				}
+
+				continue;
+			}
+
+			// split the run at row ends
+			while (length > 0) {
+				int span = MIN(length, width - column);
+
+				for (int index = 0; index < span; index++) {
+					pixel[index] = color;
+				}
+
+				pixel += span;
+				column += span;
+				length -= span;
+
+				if (column == width) {
+					column = 0;
+					pixel += stride;
+				}
+			}
+		}
+
+		return;
+	}
+
+	int row = 0;
+
+	while (runIndex < glyph->coverageCount) {
+		uint8_t level;
+		int length = glyphRun(glyph, &runIndex, &level);
+
+		if (level == 0) {
+			column += length;
+
+			while (column >= width) {
+				column -= width;
+				row++;
+			}
+		} else {
+			uint16_t color = blend[level];
+
+			while (length > 0) {
+				int span = MIN(length, width - column);
+
+				fillSpan(canvas, canvasWidth, canvasHeight, x + column, y + row, span, color);
+
+				column += span;
+				length -= span;
+
+				if (column == width) {
+					column = 0;
+					row++;
+				}
+			}
+		}
+
+		// nothing below the canvas is visible
+		if (y + row >= canvasHeight) {
+			break;
+		}
+	}
+}
+
+// draws the set pixels of a glyph, the canvas is expected to hold the background already
+//
+// blend is the table of the text and background colour, 1 bit glyphs only use full coverage
+static uint8_t drawCharacter(
+	const Font *font,
+	const Glyph *glyph,
+
+	uint16_t *canvas,
+	int canvasWidth,
+	int canvasHeight,
+
+	int x,
+	int y,
+
+	const uint16_t *blend
+) {
+	uint8_t width = glyphAdvance(font, glyph);
+	uint16_t fg = blend[BLEND_LEVELS - 1];
+
+	if (x >= canvasWidth || y >= canvasHeight || x + width <= 0 || y + font->height <= 0) {
+		return width;
+	}
+
+	if (glyph == NULL) {
+		for (int row = 0; row < font->height; row++) {
+			fillSpan(canvas, canvasWidth, canvasHeight, x, y + row, font->height, fg);
+		}
+
+		return width;
+	}
+
+	if (glyph->coverage != NULL) {
+		drawCoverage(glyph, font->height, canvas, canvasWidth, canvasHeight, x, y, blend);
+
+		return width;
+	}
+
+	bool state = false;
+	int row = 0;
+	int column = 0;
+
+	for (uint8_t segmentIndex = 0; segmentIndex < glyph->segmentCount; segmentIndex++) {
+		int length = glyph->segments[segmentIndex];
+
+		if (state) {
+			// split the run at row ends
+			while (length > 0) {
+				int span = MIN(length, glyph->width - column);
+
+				fillSpan(canvas, canvasWidth, canvasHeight, x + column, y + row, span, fg);
+
+				column += span;
+				length -= span;
+
+				if (column == glyph->width) {
+					column = 0;
+					row++;
+				}
+			}
+		} else {
+			column += length;
+			row += column / glyph->width;
+			column %= glyph->width;
+		}
+
+		// nothing below the canvas is visible
+		if (y + row >= canvasHeight) {
+			break;
+		}
+
+		state = !state;
+	}
+
+	return width;
+}
+
+// computes line breaks and the bounding box, without touching any pixels
+static void layoutText(
+	TextLayout *layout,
+	const Font *font,
+
+	const char *string,
+
+	int maxWidth,
+	int maxHeight
+) {
+	layout->font = font;
+	layout->lineCount = 0;
+	layout->width = 0;
+	layout->height = 0;
+	layout->truncated = false;
+
+	TextLine *line = NULL;
+
+	while (*string) {
+		uint8_t advance = glyphAdvance(font, findGlyph(font, *string));
+
+		if (line == NULL || (line->length > 0 && line->width + advance > maxWidth)) {
+			if (
+				layout->lineCount == TEXT_LINE_LIMIT ||
+				layout->lineCount * font->height >= maxHeight
+			) {
+				layout->truncated = true;
+
+				break;
+			}
+
+			line = &layout->lines[layout->lineCount++];
+			line->start = string;
+			line->length = 0;
+			line->width = 0;
+		}
+
+		line->length++;
+		line->width += advance;
+
+		string++;
+	}
+
+	for (uint8_t index = 0; index < layout->lineCount; index++) {
+		layout->width = MAX(layout->width, MIN(layout->lines[index].width, maxWidth));
+	}
+
+	layout->height = MIN(layout->lineCount * font->height, maxHeight);
+}
+
+// horizontal position of a line within a box of the given width
+static inline int lineOffset(const TextLine *line, int width, text_align_t align) {
+	int space = MAX(width - line->width, 0);
+
+	if (align == TEXT_ALIGN_CENTER) {
+		return space / 2;
+	}
+
+	if (align == TEXT_ALIGN_RIGHT) {
+		return space;
+	}
+
+	return 0;
+}
+
+// left edge of the tight bounding box, relative to the box
+static int layoutOffset(const TextLayout *layout, int width, text_align_t align) {
+	int offset = width;
+
+	for (uint8_t index = 0; index < layout->lineCount; index++) {
+		offset = MIN(offset, lineOffset(&layout->lines[index], width, align));
+	}
+
+	return layout->lineCount ? offset : 0;
+}
+
+static void drawLayout(
+	const TextLayout *layout,
+
+	uint16_t *canvas,
+	int canvasWidth,
+	int canvasHeight,
+
+	int x,
+	int y,
+	int width,
+	text_align_t align,
+
+	uint16_t fg,
+	uint16_t bg
+) {
+	const Font *font = layout->font;
+	const uint16_t *blend = findBlend(fg, bg);
+
+	for (uint8_t index = 0; index < layout->lineCount; index++) {
+		const TextLine *line = &layout->lines[index];
+
+		int left = x + lineOffset(line, width, align);
+		int top = y + index * font->height;
+
+		for (uint16_t character = 0; character < line->length; character++) {
+			left += drawCharacter(
+				font, findGlyph(font, line->start[character]),
+				canvas, canvasWidth, canvasHeight,
+				left, top,
+				blend
+			);
+		}
+	}
+}
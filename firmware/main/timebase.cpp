@@ -0,0 +1,217 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// station time mapped onto the collector clock
+//
+// every exchange with the time server yields four timestamps, t1 and t4 on the station,
+// t2 and t3 on the server, all microseconds:
+//
+//   offset = ((t2 - t1) + (t3 - t4)) / 2
+//   delay = (t4 - t1) - (t3 - t2)
+//
+// samples that waited in a queue on the way have a high delay and a skewed offset, only
+// samples close to the lowest recent delay are used, a line fitted through them gives the
+// offset and the drift of the local clock
+
+// recent delays the acceptance threshold is based on
+#define CLOCK_DELAY_WINDOW 8
+
+// accepted samples the drift is fitted over
+#define CLOCK_HISTORY 16
+
+// accepted delay above the lowest recent delay
+#define CLOCK_DELAY_MARGIN_US 500
+
+// drift is only estimated over at least this much local time
+#define CLOCK_DRIFT_SPAN_US (10 * 1000000LL)
+
+// crystals are specified well within this
+#define CLOCK_DRIFT_LIMIT_PPM 500
+
+// offset and drift as used on the hot path
+struct TimebaseParameters {
+	int64_t reference;
+	int64_t offset;
+
+	// drift as a fraction of 2^32
+	int64_t drift;
+};
+
+// local to synced time, readable from any task while the sync task publishes
+class Timebase {
+	public:
+		inline int64_t convert(int64_t local) const {
+			TimebaseParameters parameters;
+			uint32_t sequence;
+
+			// a slot is only rewritten two publishes later, retry if that happened meanwhile
+			do {
+				sequence = this->sequence.load(std::memory_order_acquire);
+				parameters = this->slots[sequence & 1];
+				std::atomic_thread_fence(std::memory_order_acquire);
+			} while (sequence != this->sequence.load(std::memory_order_relaxed));
+
+			return local + parameters.offset + (((local - parameters.reference) * parameters.drift) >> 32);
+		}
+
+		bool synced() const {
+			return this->sequence.load(std::memory_order_relaxed) > 0;
+		}
+
+		void publish(const TimebaseParameters *parameters) {
+			uint32_t sequence = this->sequence.load(std::memory_order_relaxed) + 1;
+
+			this->slots[sequence & 1] = *parameters;
+			this->sequence.store(sequence, std::memory_order_release);
+		}
+
+	private:
+		TimebaseParameters slots[2] = {};
+		std::atomic<uint32_t> sequence { 0 };
+};
+
+struct ClockSample {
+	int64_t local;
+	int64_t offset;
+	int64_t delay;
+};
+
+class ClockEstimator {
+	public:
+		uint32_t samples = 0;
+		uint32_t rejected = 0;
+
+		// delay of the last sample
+		int64_t delay = 0;
+
+		// false if the sample was filtered out, parameters are only updated otherwise
+		bool add(int64_t t1, int64_t t2, int64_t t3, int64_t t4, TimebaseParameters *parameters);
+
+	private:
+		int64_t delays[CLOCK_DELAY_WINDOW];
+		uint8_t delayCount = 0;
+		uint8_t delayNext = 0;
+
+		ClockSample history[CLOCK_HISTORY];
+		uint8_t historyCount = 0;
+		uint8_t historyNext = 0;
+};
+
+bool ClockEstimator::add(int64_t t1, int64_t t2, int64_t t3, int64_t t4, TimebaseParameters *parameters) {
+	ClockSample sample = {
+		t1 + (t4 - t1) / 2,
+		((t2 - t1) + (t3 - t4)) / 2,
+		(t4 - t1) - (t3 - t2)
+	};
+
+	this->samples++;
+	this->delay = sample.delay;
+
+	if (sample.delay < 0) {
+		this->rejected++;
+
+		return false;
+	}
+
+	this->delays[this->delayNext] = sample.delay;
+	this->delayNext = (this->delayNext + 1) % CLOCK_DELAY_WINDOW;
+	this->delayCount += this->delayCount < CLOCK_DELAY_WINDOW;
+
+	int64_t lowest = sample.delay;
+
+	for (uint8_t index = 0; index < this->delayCount; index++) {
+		if (this->delays[index] < lowest) {
+			lowest = this->delays[index];
+		}
+	}
+
+	if (sample.delay > lowest + CLOCK_DELAY_MARGIN_US) {
+		this->rejected++;
+
+		return false;
+	}
+
+	this->history[this->historyNext] = sample;
+	this->historyNext = (this->historyNext + 1) % CLOCK_HISTORY;
+	this->historyCount += this->historyCount < CLOCK_HISTORY;
+
+	// least squares over the accepted samples, relative to the newest one
+	double sumX = 0;
+	double sumY = 0;
+	double sumXX = 0;
+	double sumXY = 0;
+	int64_t oldest = sample.local;
+
+	for (uint8_t index = 0; index < this->historyCount; index++) {
+		double x = this->history[index].local - sample.local;
+		double y = this->history[index].offset - sample.offset;
+
+		sumX += x;
+		sumY += y;
+		sumXX += x * x;
+		sumXY += x * y;
+
+		if (this->history[index].local < oldest) {
+			oldest = this->history[index].local;
+		}
+	}
+
+	double count = this->historyCount;
+
+	parameters->reference = sample.local;
+
+	// until the drift is known, averaging older offsets would only lag behind it
+	if (sample.local - oldest < CLOCK_DRIFT_SPAN_US || count * sumXX - sumX * sumX <= 0) {
+		parameters->offset = sample.offset;
+		parameters->drift = 0;
+
+		return true;
+	}
+
+	double slope = (count * sumXY - sumX * sumY) / (count * sumXX - sumX * sumX);
+	double limit = CLOCK_DRIFT_LIMIT_PPM / 1e6;
+
+	slope = slope > limit ? limit : slope < -limit ? -limit : slope;
+
+	// the line through the mean, evaluated at the newest sample
+	double intercept = (sumY - slope * sumX) / count;
+
+	parameters->offset = sample.offset + (int64_t)intercept;
+	parameters->drift = (int64_t)(slope * 4294967296.0);
+
+	return true;
+}
+
+// the exchange on the wire, clock/index.cpp serves it on the host
+//
+//   request:  magic (1) | sequence (2) | t1 (8)
+//   response: magic (1) | sequence (2) | t1 (8) | t2 (8) | t3 (8)
+//
+// t1 is echoed, t2 and t3 are microseconds since the unix epoch on the collector,
+// all integers big endian
+
+#define CLOCK_PORT 49236
+
+#define CLOCK_MAGIC 0xc7
+#define CLOCK_REQUEST_SIZE 11
+#define CLOCK_RESPONSE_SIZE 27
+
+static inline void clockPut(uint8_t *target, uint64_t value) {
+	for (int8_t index = 7; index >= 0; index--) {
+		target[index] = (uint8_t)value;
+		value >>= 8;
+	}
+}
+
+static inline int64_t clockGet(const uint8_t *source) {
+	uint64_t value = 0;
+
+	for (uint8_t index = 0; index < 8; index++) {
+		value = (value << 8) | source[index];
+	}
+
+	return (int64_t)value;
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <string.h>
+
+#include "trace.h"
+
+#if TRACE_ENABLED
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/task.h"
+	#include "esp_attr.h"
+	#include "esp_cpu.h"
+	#include "esp_freertos_hooks.h"
+	#include "esp_ipc.h"
+	#include "esp_log.h"
+	#include "esp_timer.h"
+}
+
+// records context switches, queue and notification traffic and user markers into a ring per
+// core, dumped by the exporter at /trace and turned into a Chrome trace by trace/index.cpp
+//
+// every core only writes its own ring with interrupts masked, so recording takes no lock
+
+// events recorded at startup to measure the cost of one
+#define TRACE_CALIBRATION 1000
+
+struct TraceRing {
+	TraceCore state;
+
+	// the 32 bit counter wraps every few seconds, the tick hook keeps the extension current
+	uint32_t high;
+	uint32_t last;
+
+	TraceEvent events[TRACE_EVENTS];
+};
+
+// no initializers, the kernel creates its first tasks before constructors run and the
+// instance has to be usable as zeroed
+class Trace {
+	public:
+		volatile bool recording;
+		uint32_t overhead;
+
+		TraceRing rings[TRACE_CORES];
+
+		// task creation is serialized by the kernel lock
+		TraceTask tasks[TRACE_TASK_LIMIT];
+		uint16_t taskCount;
+
+		void begin();
+
+		// stops recording while the rings are read
+		void pause();
+		void resume();
+
+		void header(TraceHeader *header);
+};
+
+// shared instance declaration
+extern Trace trace;
+
+// shared instance definition
+Trace trace;
+
+// the caller masks interrupts
+static inline uint64_t IRAM_ATTR traceCycles(TraceRing *ring) {
+	uint32_t low = esp_cpu_get_cycle_count();
+
+	if (low < ring->last) {
+		ring->high++;
+	}
+
+	ring->last = low;
+
+	return ((uint64_t)ring->high << 32) | low;
+}
+
+extern "C" void IRAM_ATTR traceRecord(uint8_t type, const void *object, uint16_t value) {
+	if (!trace.recording) {
+		return;
+	}
+
+	UBaseType_t state = portSET_INTERRUPT_MASK_FROM_ISR();
+
+	TraceRing *ring = &trace.rings[xPortGetCoreID()];
+	TraceEvent *event = &ring->events[ring->state.head & (TRACE_EVENTS - 1)];
+
+	event->cycles = traceCycles(ring);
+	event->object = (uint32_t)(uintptr_t)object;
+	event->type = type;
+	event->value = value;
+
+	ring->state.head++;
+
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+}
+
+extern "C" void traceCreated(void *task) {
+	if (trace.taskCount >= TRACE_TASK_LIMIT) {
+		return;
+	}
+
+	TraceTask *entry = &trace.tasks[trace.taskCount++];
+
+	entry->handle = (uint32_t)(uintptr_t)task;
+	strncpy(entry->name, pcTaskGetName((TaskHandle_t)task), TRACE_NAME_SIZE);
+}
+
+static void IRAM_ATTR traceTick() {
+	UBaseType_t state = portSET_INTERRUPT_MASK_FROM_ISR();
+	traceCycles(&trace.rings[xPortGetCoreID()]);
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+}
+
+// runs on the core the anchor belongs to
+static void traceAnchor(void *args) {
+	TraceAnchor *anchor = (TraceAnchor*)args;
+
+	UBaseType_t state = portSET_INTERRUPT_MASK_FROM_ISR();
+	anchor->cycles = traceCycles(&trace.rings[xPortGetCoreID()]);
+	anchor->time = esp_timer_get_time();
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+}
+
+void Trace::begin() {
+	for (uint8_t core = 0; core < TRACE_CORES; core++) {
+		ESP_ERROR_CHECK(esp_register_freertos_tick_hook_for_cpu(traceTick, core));
+		ESP_ERROR_CHECK(esp_ipc_call_blocking(core, traceAnchor, &this->rings[core].state.start));
+	}
+
+	// the same path every hook takes, the calibration events are dropped afterwards
+	UBaseType_t state = portSET_INTERRUPT_MASK_FROM_ISR();
+	TraceRing *ring = &this->rings[xPortGetCoreID()];
+
+	this->recording = true;
+
+	uint32_t start = esp_cpu_get_cycle_count();
+
+	for (uint16_t index = 0; index < TRACE_CALIBRATION; index++) {
+		traceRecord(TRACE_MARK_BEGIN, NULL, 0);
+	}
+
+	this->overhead = (esp_cpu_get_cycle_count() - start) / TRACE_CALIBRATION;
+	ring->state.head -= TRACE_CALIBRATION;
+
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+
+	ESP_LOGI("TRACE", "recording, %u cycles per event, %u events per core",
+		(unsigned)this->overhead, TRACE_EVENTS
+	);
+}
+
+void Trace::pause() {
+	this->recording = false;
+
+	// an event being written on the other core finishes well within a tick
+	vTaskDelay(1);
+
+	for (uint8_t core = 0; core < TRACE_CORES; core++) {
+		ESP_ERROR_CHECK(esp_ipc_call_blocking(core, traceAnchor, &this->rings[core].state.end));
+	}
+}
+
+void Trace::resume() {
+	this->recording = true;
+}
+
+void Trace::header(TraceHeader *header) {
+	memcpy(header->magic, TRACE_MAGIC, sizeof(header->magic));
+
+	// power management is off, the clock stays at its default
+	header->frequency = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000;
+	header->cores = TRACE_CORES;
+	header->taskCount = this->taskCount;
+	header->events = TRACE_EVENTS;
+	header->overhead = this->overhead;
+}
+
+#endif
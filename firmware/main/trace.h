@@ -0,0 +1,144 @@
+#pragma once
+
+// task level execution trace, FreeRTOS hooks and the dump format
+//
+// plain C, with TRACE_ENABLED the build includes it ahead of every source file so the
+// kernel picks up the trace macros below, the host converter reads the dump with the same
+// structures
+//
+// off by default, enable with:
+//
+//   idf.py -DTRACE_ENABLED=1 build
+
+#ifndef TRACE_ENABLED
+	#define TRACE_ENABLED 0
+#endif
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+// events kept per core, a power of two
+#define TRACE_EVENTS 2048
+
+#define TRACE_CORES 2
+#define TRACE_TASK_LIMIT 48
+#define TRACE_NAME_SIZE 16
+
+// event types, TRACE_FROM_ISR is set for events raised in an interrupt
+#define TRACE_SWITCH_IN 1
+#define TRACE_QUEUE_SEND 2
+#define TRACE_QUEUE_RECEIVE 3
+#define TRACE_QUEUE_BLOCK_SEND 4
+#define TRACE_QUEUE_BLOCK_RECEIVE 5
+#define TRACE_NOTIFY 6
+#define TRACE_NOTIFY_WAIT 7
+#define TRACE_MARK_BEGIN 8
+#define TRACE_MARK_END 9
+
+#define TRACE_FROM_ISR 0x80
+
+// user markers, the value of TRACE_MARK_BEGIN and TRACE_MARK_END
+#define TRACE_MARK_SCAN 1
+#define TRACE_MARK_RENDER 2
+#define TRACE_MARK_TRANSFER 3
+#define TRACE_MARK_UPLINK 4
+
+#define TRACE_MAGIC "TRC1"
+
+// dump, all little endian:
+//
+//   TraceHeader | per core: TraceCore, TraceEvent[events] | TraceTask[taskCount]
+//
+// the events of a core are the raw ring, the newest one is at (head - 1) % events
+
+typedef struct {
+	// cycle counter of the core, extended to 64 bits
+	uint64_t cycles;
+
+	// queue or task handle, 0 for markers
+	uint32_t object;
+
+	uint8_t type;
+	uint8_t reserved;
+
+	// notification index or marker
+	uint16_t value;
+} TraceEvent;
+
+typedef struct {
+	char magic[4];
+
+	// cpu clock in Hz
+	uint32_t frequency;
+
+	uint16_t cores;
+	uint16_t taskCount;
+	uint32_t events;
+
+	// cycles spent recording one event, measured at startup
+	uint32_t overhead;
+} TraceHeader;
+
+// cycle counter and esp_timer read together, aligns the cores with each other
+typedef struct {
+	uint64_t cycles;
+	int64_t time;
+} TraceAnchor;
+
+typedef struct {
+	// taken when recording starts and when the dump is taken
+	TraceAnchor start;
+	TraceAnchor end;
+
+	// events written since recording started
+	uint32_t head;
+	uint32_t reserved;
+} TraceCore;
+
+typedef struct {
+	uint32_t handle;
+	char name[TRACE_NAME_SIZE];
+} TraceTask;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void traceRecord(uint8_t type, const void *object, uint16_t value);
+void traceCreated(void *task);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if TRACE_ENABLED
+
+// kernel hooks, expanded inside tasks.c and queue.c
+#define traceTASK_CREATE(pxNewTCB) traceCreated(pxNewTCB)
+#define traceTASK_SWITCHED_IN() traceRecord(TRACE_SWITCH_IN, xTaskGetCurrentTaskHandle(), 0)
+
+#define traceQUEUE_SEND(pxQueue) traceRecord(TRACE_QUEUE_SEND, pxQueue, 0)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue) traceRecord(TRACE_QUEUE_SEND | TRACE_FROM_ISR, pxQueue, 0)
+#define traceQUEUE_RECEIVE(pxQueue) traceRecord(TRACE_QUEUE_RECEIVE, pxQueue, 0)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue) traceRecord(TRACE_QUEUE_RECEIVE | TRACE_FROM_ISR, pxQueue, 0)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue) traceRecord(TRACE_QUEUE_BLOCK_SEND, pxQueue, 0)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) traceRecord(TRACE_QUEUE_BLOCK_RECEIVE, pxQueue, 0)
+
+#define traceTASK_NOTIFY(uxIndexToNotify) traceRecord(TRACE_NOTIFY, xTaskToNotify, uxIndexToNotify)
+#define traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify) traceRecord(TRACE_NOTIFY | TRACE_FROM_ISR, xTaskToNotify, uxIndexToNotify)
+#define traceTASK_NOTIFY_GIVE_FROM_ISR(uxIndexToNotify) traceRecord(TRACE_NOTIFY | TRACE_FROM_ISR, xTaskToNotify, uxIndexToNotify)
+#define traceTASK_NOTIFY_TAKE(uxIndexToWait) traceRecord(TRACE_NOTIFY_WAIT, 0, uxIndexToWait)
+#define traceTASK_NOTIFY_WAIT(uxIndexToWait) traceRecord(TRACE_NOTIFY_WAIT, 0, uxIndexToWait)
+
+#define TRACE_BEGIN(mark) traceRecord(TRACE_MARK_BEGIN, 0, mark)
+#define TRACE_END(mark) traceRecord(TRACE_MARK_END, 0, mark)
+
+#else
+
+#define TRACE_BEGIN(mark)
+#define TRACE_END(mark)
+
+#endif
+
+#endif
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+extern "C" {
+	#include "freertos/FreeRTOS.h"
+	#include "freertos/task.h"
+	#include "freertos/queue.h"
+	#include "esp_log.h"
+	#include "esp_timer.h"
+}
+
+#include "memory.cpp"
+#include "network.cpp"
+#include "batch.cpp"
+#include "record.cpp"
+#include "rules/tags.cpp"
+#include "trace.cpp"
+
+#define UPLINK_HOST "192.168.31.137"
+#define UPLINK_PORT 49234
+
+#define UPLINK_STACK_SIZE 4096
+
+// minimum time between two connection attempts
+#define UPLINK_RETRY_MS 1000
+
+static inline tag_priority_t uplinkPriority(const ScanRecord *record) {
+	return tagPriority(&tagRules, record->family);
+}
+
+class Uplink {
+	public:
+		QueueHandle_t queue = NULL;
+
+		// counters, written by the uplink task only
+		uint32_t batches = 0;
+		uint32_t scans = 0;
+		uint32_t dropped = 0;
+		uint32_t bytes = 0;
+
+		// scans rejected because the queue was full, written by submit
+		uint32_t overflow = 0;
+
+		// truncated scans, not sent as the collector would take them for whole ones, written
+		// by submit
+		uint32_t truncated = 0;
+
+		void begin();
+
+		// hands a completed scan to the batching stage, never blocks
+		//
+		// takes over one reference of the record
+		bool submit(ScanRecord *record);
+
+		void run();
+
+	private:
+		int connection = -1;
+		int64_t lastAttempt = 0;
+
+		uint8_t buffer[BATCH_SIZE_LIMIT];
+
+		bool connect();
+		void disconnect();
+		bool send(const uint8_t *data, size_t length);
+};
+
+// shared instance declaration
+extern Uplink uplink;
+
+// shared instance definition
+Uplink uplink;
+
+TASK_STORAGE(uplink, UPLINK_STACK_SIZE)
+QUEUE_STORAGE(uplinkScan, UPLINK_QUEUE_LENGTH, ScanRecord *)
+
+static void uplinkTask(void *args) {
+	uplink.run();
+}
+
+void Uplink::begin() {
+	this->queue = memory.createQueue(
+		"uplink",
+		UPLINK_QUEUE_LENGTH, sizeof(ScanRecord *),
+		QUEUE_STORAGE_OF(uplinkScan)
+	);
+
+	memory.createTask(
+		uplinkTask,
+		"uplink", "uplink",
+		UPLINK_STACK_SIZE,
+		NULL,
+		3, tskNO_AFFINITY,
+		TASK_STORAGE_OF(uplink)
+	);
+}
+
+bool Uplink::submit(ScanRecord *record) {
+	if (record->truncated) {
+		this->truncated++;
+		recordRelease(record);
+
+		return false;
+	}
+
+	bool yield =
+		uplinkPriority(record) == TAG_PRIORITY_LOW &&
+		uxQueueMessagesWaiting(this->queue) >= UPLINK_LOW_PRIORITY_LIMIT;
+
+	if (yield || xQueueSend(this->queue, &record, 0) != pdTRUE) {
+		this->overflow++;
+		recordRelease(record);
+
+		return false;
+	}
+
+	return true;
+}
+
+bool Uplink::connect() {
+	if (this->connection >= 0) {
+		return true;
+	}
+
+	int64_t now = esp_timer_get_time();
+
+	if (!network.ready || now - this->lastAttempt < UPLINK_RETRY_MS * 1000) {
+		return false;
+	}
+
+	this->lastAttempt = now;
+
+	int connection = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+
+	if (connection < 0) {
+		ESP_LOGE("UPLINK", "unable to create socket: errno %d", errno);
+
+		return false;
+	}
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(UPLINK_PORT);
+	inet_pton(AF_INET, UPLINK_HOST, &address.sin_addr.s_addr);
+
+	if (::connect(connection, (struct sockaddr *)&address, sizeof(address)) != 0) {
+		ESP_LOGE("UPLINK", "unable to connect: errno %d", errno);
+		close(connection);
+
+		return false;
+	}
+
+	// batches are already sized, do not wait for more data
+	int enable = 1;
+	setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+	struct timeval timeout = { 1, 0 };
+	setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+	ESP_LOGI("UPLINK", "connected to %s:%u", UPLINK_HOST, UPLINK_PORT);
+	this->connection = connection;
+
+	return true;
+}
+
+void Uplink::disconnect() {
+	shutdown(this->connection, 0);
+	close(this->connection);
+
+	this->connection = -1;
+}
+
+bool Uplink::send(const uint8_t *data, size_t length) {
+	if (!this->connect()) {
+		return false;
+	}
+
+	// each batch is prefixed with its length
+	uint8_t prefix[2] = { (uint8_t)(length >> 8), (uint8_t)length };
+
+	if (
+		::send(this->connection, prefix, sizeof(prefix), 0) != sizeof(prefix) ||
+		::send(this->connection, data, length, 0) != (ssize_t)length
+	) {
+		ESP_LOGE("UPLINK", "send failed: errno %d", errno);
+		this->disconnect();
+
+		return false;
+	}
+
+	return true;
+}
+
+void Uplink::run() {
+	ScanRecord *record;
+	bool carried = false;
+
+	BatchEncoder encoder;
+
+	while (true) {
+		// a scan that did not fit opens the next batch
+		if (!carried) {
+			xQueueReceive(this->queue, &record, portMAX_DELAY);
+		}
+
+		// the encoder copies the tag, the record is not needed afterwards
+		encoder.begin(this->buffer, BATCH_SIZE_LIMIT, record->time);
+		encoder.append(record->data(), record->length, record->time);
+
+		// high priority scans go out without waiting for the batch to fill
+		bool urgent = uplinkPriority(record) == TAG_PRIORITY_HIGH;
+		recordRelease(record);
+
+		carried = false;
+
+		TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(BATCH_LATENCY_MS);
+
+		while (!urgent && encoder.count < BATCH_RECORD_LIMIT) {
+			TickType_t remaining = deadline - xTaskGetTickCount();
+
+			// the deadline has passed once the difference wraps
+			if ((int32_t)remaining <= 0 || xQueueReceive(this->queue, &record, remaining) != pdTRUE) {
+				break;
+			}
+
+			if (!encoder.append(record->data(), record->length, record->time)) {
+				carried = true;
+
+				break;
+			}
+
+			urgent = uplinkPriority(record) == TAG_PRIORITY_HIGH;
+			recordRelease(record);
+		}
+
+		size_t length = encoder.finish();
+
+		TRACE_BEGIN(TRACE_MARK_UPLINK);
+
+		if (this->send(this->buffer, length)) {
+			this->batches++;
+			this->scans += encoder.count;
+			this->bytes += length;
+		} else {
+			this->dropped += encoder.count;
+		}
+
+		TRACE_END(TRACE_MARK_UPLINK);
+	}
+}
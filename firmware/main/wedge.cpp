@@ -0,0 +1,131 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "record.cpp"
+
+// keyboard wedge scanners, boot protocol keyboard reports
+//
+// the scanner types the symbol key by key and ends it with enter, tab or space, every key
+// takes a press and a release report, pos/index.cpp replays wedge and POS scanners through
+// their decoders on the host
+
+// boot report: modifiers (1) | reserved (1) | keys (6)
+#define WEDGE_REPORT_SIZE 8
+#define WEDGE_KEY_OFFSET 2
+#define WEDGE_KEY_LIMIT 6
+
+// left and right shift in the modifier byte
+#define WEDGE_MODIFIER_SHIFT 0x22
+
+// key codes up to this one are errors, not keys
+#define WEDGE_KEY_ERROR 0x03
+
+#define WEDGE_KEY_A 0x04
+#define WEDGE_KEY_Z 0x1d
+#define WEDGE_KEY_1 0x1e
+#define WEDGE_KEY_9 0x26
+#define WEDGE_KEY_0 0x27
+#define WEDGE_KEY_ENTER 0x28
+#define WEDGE_KEY_TAB 0x2b
+#define WEDGE_KEY_SPACE 0x2c
+
+static inline bool wedgeKeyFound(const uint8_t *keys, uint8_t key) {
+	for (uint8_t index = 0; index < WEDGE_KEY_LIMIT; index++) {
+		if (keys[index] == key) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// assembles symbols from the key releases of boot keyboard reports
+class WedgeDecoder {
+	public:
+		// the last complete symbol, valid after feed returned true
+		char symbol[RECORD_LENGTH_LIMIT];
+
+		// counts one past RECORD_LENGTH_LIMIT for longer symbols, the arena marks them truncated
+		uint32_t length = 0;
+
+		// true once a report completes a symbol
+		bool feed(const uint8_t *report, size_t reportLength);
+
+	private:
+		uint8_t keys[WEDGE_KEY_LIMIT] = {};
+
+		// modifiers of the previous report, the last one a released key was down in
+		uint8_t modifiers = 0;
+
+		char buffer[RECORD_LENGTH_LIMIT];
+		uint32_t index = 0;
+
+		bool release(uint8_t key, bool shift);
+};
+
+bool WedgeDecoder::release(uint8_t key, bool shift) {
+	if (key == WEDGE_KEY_ENTER || key == WEDGE_KEY_TAB || key == WEDGE_KEY_SPACE) {
+		bool complete = this->index > 0;
+
+		if (complete) {
+			this->length = this->index;
+			memcpy(this->symbol, this->buffer, this->length < RECORD_LENGTH_LIMIT ? this->length : RECORD_LENGTH_LIMIT);
+		}
+
+		this->index = 0;
+
+		return complete;
+	}
+
+	char character = 0;
+
+	if (key == WEDGE_KEY_0) {
+		character = '0';
+	}
+
+	if (key >= WEDGE_KEY_1 && key <= WEDGE_KEY_9) {
+		character = '1' + (key - WEDGE_KEY_1);
+	}
+
+	if (key >= WEDGE_KEY_A && key <= WEDGE_KEY_Z) {
+		character = (shift ? 'A' : 'a') + (key - WEDGE_KEY_A);
+	}
+
+	// characters past the limit are dropped, the record is marked as truncated
+	if (character != 0 && this->index <= RECORD_LENGTH_LIMIT) {
+		if (this->index < RECORD_LENGTH_LIMIT) {
+			this->buffer[this->index] = character;
+		}
+
+		this->index++;
+	}
+
+	return false;
+}
+
+bool WedgeDecoder::feed(const uint8_t *report, size_t reportLength) {
+	if (reportLength < WEDGE_REPORT_SIZE) {
+		return false;
+	}
+
+	const uint8_t *keys = report + WEDGE_KEY_OFFSET;
+	bool complete = false;
+
+	// characters are taken when their key goes up, scanners let go of shift together with
+	// the key, so the case comes from the report the key was still down in
+	bool shift = this->modifiers & WEDGE_MODIFIER_SHIFT;
+
+	for (uint8_t index = 0; index < WEDGE_KEY_LIMIT; index++) {
+		if (this->keys[index] > WEDGE_KEY_ERROR && !wedgeKeyFound(keys, this->keys[index])) {
+			complete |= this->release(this->keys[index], shift);
+		}
+	}
+
+	memcpy(this->keys, keys, WEDGE_KEY_LIMIT);
+	this->modifiers = report[0];
+
+	return complete;
+}
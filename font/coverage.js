@@ -0,0 +1,122 @@
+// 4 bit coverage for a generated 1 bit font, for fonts whose source is not at hand
+//
+// decodes the segments the way the station draws them and spreads every edge over the
+// neighbouring pixels with a 3x3 binomial filter, the filter keeps the amount of ink, so
+// strokes keep their weight and only the stair steps soften
+//
+// rendering the source font with index.html gives the real coverage and replaces this
+//
+// usage:
+//
+//   node coverage.js ../firmware/main/font/mono-40.cpp
+
+const fs = require('fs');
+
+const path = process.argv[2];
+const source = fs.readFileSync(path, 'utf8');
+
+const font = /static const Font (\w+) = \{ (\d+), \w+, (\d+) \};/.exec(source);
+const fontObjectName = font[1];
+const height = parseInt(font[2]);
+
+const data = {};
+
+for (const match of source.matchAll(/static const uint16_t (\w+)\[\] = \{ ([\d, ]*) \};/g)) {
+	data[match[1]] = match[2].split(', ').map(value => parseInt(value));
+}
+
+// runs of 16 pixels or more take a second byte, see GLYPH_RUN_EXTENDED in font/index.cpp
+function pushRun(coverage, level, run) {
+	if (run < 16) {
+		coverage.push((level << 4) | (run - 1));
+	} else {
+		coverage.push((level << 4) | 0x0F, run - 16);
+	}
+}
+
+const glyphs = [];
+
+for (const match of source.matchAll(/\{ '(.)', (\d+), (\w+), (\d+)(?:, \w+, \d+)?\}/g)) {
+	const character = match[1];
+	const characterWidth = parseInt(match[2]);
+	const segments = data[match[3]];
+
+	// set pixels as the segments are drawn, off first, a run continues on the next row
+	const mask = new Uint8Array(characterWidth * height);
+
+	let offset = 0;
+	let state = false;
+
+	for (const length of segments) {
+		if (state) {
+			mask.fill(1, offset, Math.min(offset + length, mask.length));
+		}
+
+		offset += length;
+		state = !state;
+	}
+
+	const weights = [1, 2, 1];
+	const coverage = [];
+
+	let lastLevel = -1;
+	let run = 0;
+
+	for (let offset = 0; offset < height * characterWidth; offset++) {
+		const row = Math.floor(offset / characterWidth);
+		const column = offset % characterWidth;
+
+		// pixels outside of the glyph box count as empty, ink never leaves the box
+		let sum = 0;
+
+		for (let y = -1; y <= 1; y++) {
+			for (let x = -1; x <= 1; x++) {
+				if (row + y >= 0 && row + y < height && column + x >= 0 && column + x < characterWidth) {
+					sum += mask[(row + y) * characterWidth + column + x] * weights[y + 1] * weights[x + 1];
+				}
+			}
+		}
+
+		const level = Math.round(sum * 15 / 16);
+
+		if (level != lastLevel || run == 271) {
+			if (run > 0) {
+				pushRun(coverage, lastLevel, run);
+			}
+
+			lastLevel = level;
+			run = 0;
+		}
+
+		run++;
+	}
+
+	pushRun(coverage, lastLevel, run);
+
+	glyphs.push({
+		dataIdentifier: match[3],
+		coverageIdentifier: `glyph${character.charCodeAt(0)}${fontObjectName}Coverage`,
+		character,
+		characterWidth,
+		segments,
+		coverage
+	});
+}
+
+const header = /^[\s\S]*?\/\/\n(?=static const uint16_t)/.exec(source)[0]
+	.replace(/\/\/ coverage by[^\n]*\n\/\/\n/, '');
+
+const definition = `${header}// coverage by /font/coverage.js from the 1 bit segments
+//
+${glyphs.map(glyph => `static const uint16_t ${glyph.dataIdentifier}[] = { ${glyph.segments.join(', ')} };`).join('\n')}
+
+${glyphs.map(glyph => `static const uint8_t ${glyph.coverageIdentifier}[] = { ${glyph.coverage.join(', ')} };`).join('\n')}
+
+static const Glyph ${fontObjectName}Glyphs[] = {
+${glyphs.map(glyph => `\t{ '${glyph.character}', ${glyph.characterWidth}, ${glyph.dataIdentifier}, ${glyph.segments.length}, ${glyph.coverageIdentifier}, ${glyph.coverage.length}}`).join(',\n')}
+};
+
+static const Font ${fontObjectName} = { ${height}, ${fontObjectName}Glyphs, ${glyphs.length} };
+`;
+
+fs.writeFileSync(path, definition);
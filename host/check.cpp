@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+#include <stdio.h>
+
+// checks shared by the host tools, included as "../host/check.cpp"
+//
+// a failed check prints its case and what went wrong, the run goes on so one pass reports
+// every failure
+
+static int failures = 0;
+
+static inline void expect(bool condition, const char *name, const char *what) {
+	if (!condition) {
+		printf("FAIL %s: %s\n", name, what);
+		failures++;
+	}
+}
+
+static inline void expect(bool condition, const char *name, const std::string &what) {
+	expect(condition, name, what.c_str());
+}
+
+// prints ok if nothing failed, returns the exit status of the check
+static inline int checkResult() {
+	if (failures == 0) {
+		printf("ok\n");
+	}
+
+	return failures == 0 ? 0 : 1;
+}
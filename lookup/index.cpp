@@ -0,0 +1,470 @@
+// tag lookup server stand-in and station replay
+//
+// serves the lookup protocol with a configurable answer delay, and replays a scan stream
+// through the station answer cache against it, see firmware/main/answer.cpp
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -pthread -I../firmware/main index.cpp -o lookup
+//
+// usage:
+//
+//   ./lookup serve [options]      answers stations, LOOKUP_PORT by default
+//   ./lookup replay [options]     runs scans against a local server, reports hit rate and p99
+//
+//   --port P          server port (LOOKUP_PORT for serve, any for replay)
+//   --delay MS        fixed answer delay (5)
+//   --jitter MS       mean extra answer delay, exponential (10)
+//   --hold P          share of tags answered with the hold flag (0.02)
+//   --ttl S           answer ttl, 0 for the station default (0)
+//   --rate R          scans per second for replay (20)
+//   --repeat P        share of scans repeating one of the recent tags (0.3)
+//   --recent N        tags a repeat is drawn from (100)
+//   --duration S      replay run time (30)
+//
+// replay times scan to answer, the station adds the frame time on top and exports the total
+// as tag_lookup_display_seconds, every answer is checked against the destination the server
+// meant to send
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include "answer.cpp"
+
+struct Options {
+	int port = -1;
+	double delay = 5;
+	double jitter = 10;
+	double hold = 0.02;
+	int ttl = 0;
+	double rate = 20;
+	double repeat = 0.3;
+	int recent = 100;
+	double duration = 30;
+};
+
+static Options options;
+
+static int64_t now() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()
+	).count();
+}
+
+// the answer the server gives for a tag, from 4 up to the full LOOKUP_DESTINATION_LIMIT
+static std::string destinationOf(const char *tag) {
+	uint32_t hash = lookupHash(tag);
+
+	char destination[LOOKUP_DESTINATION_LIMIT + 1];
+	snprintf(destination, sizeof(destination), "C%03u", hash % 1000);
+
+	std::string result = destination;
+	size_t length = 4 + (hash >> 10) % (LOOKUP_DESTINATION_LIMIT - 3);
+
+	while (result.size() < length) {
+		result += (char)('A' + (hash >> (result.size() % 24)) % 26);
+	}
+
+	return result;
+}
+
+static bool holdOf(const char *tag) {
+	return (lookupHash(tag) >> 16) % 10000 < options.hold * 10000;
+}
+
+// answers one connection, every answer is delayed on its own so they overtake each other
+static void serveConnection(int connection) {
+	struct Pending {
+		int64_t due;
+		std::vector<uint8_t> response;
+
+		bool operator<(const Pending &other) const {
+			return this->due > other.due;
+		}
+	};
+
+	std::mt19937 random(connection);
+	std::exponential_distribution<double> jitter(options.jitter > 0 ? 1 / options.jitter : 1e9);
+
+	std::priority_queue<Pending> pending;
+	std::vector<uint8_t> received;
+
+	while (true) {
+		int64_t time = now();
+
+		while (!pending.empty() && pending.top().due <= time) {
+			const std::vector<uint8_t> &response = pending.top().response;
+
+			if (send(connection, response.data(), response.size(), MSG_NOSIGNAL) != (ssize_t)response.size()) {
+				close(connection);
+
+				return;
+			}
+
+			pending.pop();
+		}
+
+		int timeout = pending.empty() ? 100 : std::max<int64_t>(0, (pending.top().due - time + 999) / 1000);
+
+		struct pollfd ready = { connection, POLLIN, 0 };
+
+		if (poll(&ready, 1, timeout) <= 0) {
+			continue;
+		}
+
+		uint8_t buffer[512];
+		ssize_t length = recv(connection, buffer, sizeof(buffer), 0);
+
+		if (length <= 0) {
+			close(connection);
+
+			return;
+		}
+
+		received.insert(received.end(), buffer, buffer + length);
+
+		while (
+			received.size() >= LOOKUP_REQUEST_HEADER_SIZE &&
+			received.size() >= LOOKUP_REQUEST_HEADER_SIZE + (size_t)received[2]
+		) {
+			std::string tag(received.begin() + LOOKUP_REQUEST_HEADER_SIZE, received.begin() + LOOKUP_REQUEST_HEADER_SIZE + received[2]);
+			std::string destination = destinationOf(tag.c_str());
+
+			Pending answer;
+			answer.due = now() + (int64_t)((options.delay + jitter(random)) * 1000);
+
+			answer.response = {
+				received[0], received[1],
+				(uint8_t)(holdOf(tag.c_str()) ? LOOKUP_FLAG_HOLD : 0),
+				(uint8_t)(options.ttl >> 8), (uint8_t)options.ttl,
+				(uint8_t)destination.size()
+			};
+
+			answer.response.insert(answer.response.end(), destination.begin(), destination.end());
+			pending.push(answer);
+
+			received.erase(received.begin(), received.begin() + LOOKUP_REQUEST_HEADER_SIZE + received[2]);
+		}
+	}
+}
+
+static int listener = -1;
+static uint16_t listenerPort = 0;
+
+static void listen(int port) {
+	listener = socket(AF_INET, SOCK_STREAM, 0);
+
+	int enable = 1;
+	setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(port);
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	if (bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 || ::listen(listener, 16) != 0) {
+		perror("bind");
+		exit(1);
+	}
+
+	socklen_t length = sizeof(address);
+	getsockname(listener, (struct sockaddr *)&address, &length);
+	listenerPort = ntohs(address.sin_port);
+}
+
+static void serve() {
+	while (true) {
+		int connection = accept(listener, NULL, NULL);
+
+		if (connection < 0) {
+			continue;
+		}
+
+		int enable = 1;
+		setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+		std::thread(serveConnection, connection).detach();
+	}
+}
+
+static double percentile(std::vector<double> values, double fraction) {
+	if (values.empty()) {
+		return 0;
+	}
+
+	size_t index = std::min(values.size() - 1, (size_t)(fraction * values.size()));
+	std::nth_element(values.begin(), values.begin() + index, values.end());
+
+	return values[index];
+}
+
+// the station side: scans hit the cache or go out pipelined, as in Lookup::send and answer
+static int replay() {
+	listen(options.port < 0 ? 0 : options.port);
+	std::thread(serve).detach();
+
+	int connection = socket(AF_INET, SOCK_STREAM, 0);
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(listenerPort);
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (connect(connection, (struct sockaddr *)&address, sizeof(address)) != 0) {
+		perror("connect");
+
+		return 1;
+	}
+
+	int enable = 1;
+	setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+	struct Inflight {
+		std::string tag;
+		int64_t sent;
+	};
+
+	// scans waiting for the answer to their tag, a repeated tag in flight is not sent again
+	std::map<uint16_t, Inflight> inflight;
+	std::multimap<std::string, int64_t> waiting;
+
+	LookupCache cache;
+
+	std::mt19937 random(30);
+	std::exponential_distribution<double> gap(options.rate / 1e6);
+	std::uniform_real_distribution<double> chance(0, 1);
+
+	std::deque<std::string> recent;
+	uint64_t serial = 4711000;
+	uint16_t nextId = 0;
+
+	uint32_t scans = 0, hits = 0, misses = 0, answers = 0, timeouts = 0, dropped = 0, wrong = 0, longest = 0;
+	std::vector<double> all, missed;
+
+	std::vector<uint8_t> received;
+
+	const int64_t start = now();
+	const int64_t end = start + (int64_t)(options.duration * 1e6);
+	int64_t nextScan = start;
+
+	while (true) {
+		int64_t time = now();
+
+		if (time >= end && inflight.empty()) {
+			break;
+		}
+
+		if (time >= nextScan && time < end) {
+			nextScan += (int64_t)gap(random);
+			scans++;
+
+			std::string tag;
+
+			// labels seen again, rescans and totes on their second pass
+			if (!recent.empty() && chance(random) < options.repeat) {
+				tag = recent[random() % recent.size()];
+			} else {
+				char buffer[LOOKUP_TAG_LIMIT];
+				snprintf(buffer, sizeof(buffer), "00340123450%09llu", (unsigned long long)serial++);
+
+				tag = buffer;
+				recent.push_back(tag);
+
+				if ((int)recent.size() > options.recent) {
+					recent.pop_front();
+				}
+			}
+
+			LookupResult result;
+
+			if (cache.get(tag.c_str(), time / 1000, &result)) {
+				hits++;
+				all.push_back(0);
+
+				wrong += result.destination != destinationOf(tag.c_str());
+
+				continue;
+			}
+
+			misses++;
+
+			bool sent = false;
+
+			for (const auto &entry : inflight) {
+				sent = sent || entry.second.tag == tag;
+			}
+
+			if (!sent && inflight.size() == LOOKUP_INFLIGHT_LIMIT) {
+				dropped++;
+
+				continue;
+			}
+
+			if (!sent) {
+				uint8_t request[LOOKUP_REQUEST_HEADER_SIZE + LOOKUP_TAG_LIMIT];
+				uint16_t id = nextId++;
+
+				request[0] = id >> 8;
+				request[1] = id & 0xff;
+				request[2] = tag.size();
+				memcpy(request + LOOKUP_REQUEST_HEADER_SIZE, tag.data(), tag.size());
+
+				send(connection, request, LOOKUP_REQUEST_HEADER_SIZE + tag.size(), MSG_NOSIGNAL);
+				inflight[id] = { tag, time };
+			}
+
+			waiting.insert({ tag, time });
+		}
+
+		// expired requests, their scans never see an answer
+		for (auto entry = inflight.begin(); entry != inflight.end();) {
+			if (time - entry->second.sent > LOOKUP_TIMEOUT_MS * 1000) {
+				timeouts++;
+				waiting.erase(entry->second.tag);
+				entry = inflight.erase(entry);
+			} else {
+				entry++;
+			}
+		}
+
+		int timeout = std::max<int64_t>(0, std::min<int64_t>(nextScan - time, 10000) / 1000);
+		struct pollfd ready = { connection, POLLIN, 0 };
+
+		if (poll(&ready, 1, timeout) <= 0) {
+			continue;
+		}
+
+		uint8_t buffer[512];
+		ssize_t length = recv(connection, buffer, sizeof(buffer), 0);
+
+		if (length <= 0) {
+			fprintf(stderr, "connection lost\n");
+
+			return 1;
+		}
+
+		received.insert(received.end(), buffer, buffer + length);
+
+		while (
+			received.size() >= LOOKUP_RESPONSE_HEADER_SIZE &&
+			received.size() >= LOOKUP_RESPONSE_HEADER_SIZE + (size_t)received[5]
+		) {
+			time = now();
+
+			LookupResult result = {};
+			uint16_t ttl;
+			uint16_t id = lookupDecode(received.data(), &result, &ttl);
+
+			received.erase(received.begin(), received.begin() + LOOKUP_RESPONSE_HEADER_SIZE + received[5]);
+
+			auto entry = inflight.find(id);
+
+			if (entry == inflight.end()) {
+				continue;
+			}
+
+			const std::string &tag = entry->second.tag;
+
+			strcpy(result.tag, tag.c_str());
+			cache.put(&result, time / 1000 + (ttl ? ttl * 1000 : LOOKUP_TTL_MS));
+
+			wrong += result.destination != destinationOf(tag.c_str());
+			longest += strlen(result.destination) == LOOKUP_DESTINATION_LIMIT;
+			answers++;
+
+			auto range = waiting.equal_range(tag);
+
+			for (auto scan = range.first; scan != range.second; scan++) {
+				all.push_back((time - scan->second) / 1000.0);
+				missed.push_back((time - scan->second) / 1000.0);
+			}
+
+			waiting.erase(tag);
+			inflight.erase(entry);
+		}
+	}
+
+	printf("scans %u, hits %u, misses %u, hit rate %.1f%%\n", scans, hits, misses, scans ? 100.0 * hits / scans : 0);
+	printf("answers %u, timeouts %u, dropped %u, wrong %u, full length destinations %u\n", answers, timeouts, dropped, wrong, longest);
+
+	printf("scan to answer ms, all scans: p50 %.1f, p90 %.1f, p99 %.1f, max %.1f\n",
+		percentile(all, 0.5), percentile(all, 0.9), percentile(all, 0.99), percentile(all, 1)
+	);
+
+	printf("scan to answer ms, misses:    p50 %.1f, p90 %.1f, p99 %.1f, max %.1f\n",
+		percentile(missed, 0.5), percentile(missed, 0.9), percentile(missed, 0.99), percentile(missed, 1)
+	);
+
+	return wrong == 0 ? 0 : 1;
+}
+
+static bool parseOptions(int count, char **arguments) {
+	for (int index = 2; index + 1 < count; index += 2) {
+		std::string name = arguments[index];
+		const char *value = arguments[index + 1];
+
+		if (name == "--port") {
+			options.port = atoi(value);
+		} else if (name == "--delay") {
+			options.delay = atof(value);
+		} else if (name == "--jitter") {
+			options.jitter = atof(value);
+		} else if (name == "--hold") {
+			options.hold = atof(value);
+		} else if (name == "--ttl") {
+			options.ttl = atoi(value);
+		} else if (name == "--rate") {
+			options.rate = std::max(0.1, atof(value));
+		} else if (name == "--repeat") {
+			options.repeat = atof(value);
+		} else if (name == "--recent") {
+			options.recent = std::max(1, atoi(value));
+		} else if (name == "--duration") {
+			options.duration = atof(value);
+		} else {
+			return false;
+		}
+	}
+
+	return count % 2 == 0;
+}
+
+int main(int count, char **arguments) {
+	std::string mode = count > 1 ? arguments[1] : "";
+
+	if ((mode != "serve" && mode != "replay") || !parseOptions(count, arguments)) {
+		fprintf(stderr, "usage: %s serve|replay [--port P] [--delay MS] [--jitter MS] [--hold P] [--ttl S] [--rate R] [--repeat P] [--recent N] [--duration S]\n", arguments[0]);
+
+		return 1;
+	}
+
+	if (mode == "replay") {
+		return replay();
+	}
+
+	listen(options.port < 0 ? LOOKUP_PORT : options.port);
+	printf("serving on port %u, %.0f ms delay, %.0f ms mean jitter\n", listenerPort, options.delay, options.jitter);
+
+	serve();
+
+	return 0;
+}
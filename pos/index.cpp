@@ -0,0 +1,381 @@
+// scanner trace replay
+//
+// feeds HID report traces through the station decoders, see firmware/main/pos.cpp and
+// firmware/main/wedge.cpp, checks the decoded symbols and compares the POS path with the
+// keyboard wedge path for the same symbols
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -I../firmware/main index.cpp -o pos
+//
+// usage:
+//
+//   ./pos replay TRACE...
+//
+// a trace is text, one item per line, hex bytes without separators:
+//
+//   mode pos | wedge            decoder the reports are meant for
+//   interval MS                 endpoint polling interval, bInterval of the scanner
+//   descriptor HEX              report descriptor, POS traces only
+//   report TIME HEX             input report, TIME in microseconds, 0 if unknown
+//   expect SYMBOLOGY TEXT       symbol completed by the report before, SYMBOLOGY - if none,
+//                               TEXT is the rest of the line
+//
+// the station prints traces in this format with SCAN_CAPTURE set in scan.cpp
+//
+// scanners deliver at most one report per polling interval, so the reports a symbol takes
+// set the scan rate a decoder path can reach, the wedge path takes a press and a release
+// report per character and for the final enter
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pos.cpp"
+#include "wedge.cpp"
+
+// repetitions of a trace when timing the decoders
+#define REPLAY_ROUNDS 2000
+
+struct Report {
+	int64_t time;
+	std::vector<uint8_t> data;
+};
+
+struct Expectation {
+	// index of the report that completes the symbol
+	size_t report;
+
+	std::string text;
+	std::string symbology;
+};
+
+struct Trace {
+	std::string path;
+	std::string mode;
+	double interval = 1;
+
+	std::vector<uint8_t> descriptor;
+	std::vector<Report> reports;
+	std::vector<Expectation> expectations;
+};
+
+static bool parseHex(const std::string &text, std::vector<uint8_t> *bytes) {
+	if (text.size() % 2) {
+		return false;
+	}
+
+	for (size_t index = 0; index < text.size(); index += 2) {
+		if (!isxdigit((unsigned char)text[index]) || !isxdigit((unsigned char)text[index + 1])) {
+			return false;
+		}
+
+		bytes->push_back(strtoul(text.substr(index, 2).c_str(), NULL, 16));
+	}
+
+	return true;
+}
+
+static bool load(const char *path, Trace *trace) {
+	std::ifstream file(path);
+
+	if (!file) {
+		perror(path);
+
+		return false;
+	}
+
+	trace->path = path;
+
+	std::string line;
+	int number = 0;
+
+	while (std::getline(file, line)) {
+		number++;
+
+		std::istringstream fields(line);
+		std::string item;
+
+		if (!(fields >> item) || item[0] == '#') {
+			continue;
+		}
+
+		bool valid = true;
+
+		if (item == "mode") {
+			valid = (fields >> trace->mode) && (trace->mode == "pos" || trace->mode == "wedge");
+		} else if (item == "interval") {
+			valid = (bool)(fields >> trace->interval);
+		} else if (item == "descriptor") {
+			std::string hex;
+			valid = (fields >> hex) && parseHex(hex, &trace->descriptor);
+		} else if (item == "report") {
+			Report report;
+			std::string hex;
+
+			valid = (fields >> report.time >> hex) && parseHex(hex, &report.data);
+			trace->reports.push_back(report);
+		} else if (item == "expect") {
+			Expectation expectation;
+			expectation.report = trace->reports.size() - 1;
+
+			valid = !trace->reports.empty() && (fields >> expectation.symbology) && fields.get() == ' ';
+			std::getline(fields, expectation.text);
+
+			if (expectation.symbology == "-") {
+				expectation.symbology.clear();
+			}
+
+			trace->expectations.push_back(expectation);
+		} else {
+			valid = false;
+		}
+
+		if (!valid) {
+			fprintf(stderr, "%s:%d: cannot read '%s'\n", path, number, line.c_str());
+
+			return false;
+		}
+	}
+
+	if (trace->mode.empty() || (trace->mode == "pos" && trace->descriptor.empty())) {
+		fprintf(stderr, "%s: mode or descriptor missing\n", path);
+
+		return false;
+	}
+
+	return true;
+}
+
+struct Symbol {
+	size_t report;
+
+	std::string text;
+	std::string symbology;
+};
+
+// runs the reports through the decoder of the trace, false if the descriptor is no POS scanner
+static bool decode(const Trace &trace, std::vector<Symbol> *symbols, uint32_t *truncated) {
+	if (trace.mode == "wedge") {
+		WedgeDecoder decoder;
+
+		for (size_t index = 0; index < trace.reports.size(); index++) {
+			const Report &report = trace.reports[index];
+
+			if (decoder.feed(report.data.data(), report.data.size())) {
+				uint32_t length = decoder.length < RECORD_LENGTH_LIMIT ? decoder.length : RECORD_LENGTH_LIMIT;
+				*truncated += decoder.length > RECORD_LENGTH_LIMIT;
+
+				symbols->push_back({ index, std::string(decoder.symbol, length), "" });
+			}
+		}
+
+		return true;
+	}
+
+	PosDecoder decoder;
+
+	if (!posParseDescriptor(trace.descriptor.data(), trace.descriptor.size(), &decoder.layout)) {
+		return false;
+	}
+
+	for (size_t index = 0; index < trace.reports.size(); index++) {
+		const Report &report = trace.reports[index];
+
+		if (decoder.feed(report.data.data(), report.data.size())) {
+			uint32_t length = decoder.length < RECORD_LENGTH_LIMIT ? decoder.length : RECORD_LENGTH_LIMIT;
+			*truncated += decoder.length > RECORD_LENGTH_LIMIT;
+
+			symbols->push_back({ index, std::string(decoder.symbol, length), decoder.symbology });
+		}
+	}
+
+	return true;
+}
+
+// boot keyboard reports typing a symbol as a wedge scanner does, letters with shift held
+static std::vector<Report> wedgeReports(const std::string &text) {
+	std::vector<Report> reports;
+
+	auto key = [&](uint8_t code, uint8_t modifiers) {
+		Report press = { 0, std::vector<uint8_t>(WEDGE_REPORT_SIZE, 0) };
+		press.data[0] = modifiers;
+		press.data[WEDGE_KEY_OFFSET] = code;
+
+		reports.push_back(press);
+		reports.push_back({ 0, std::vector<uint8_t>(WEDGE_REPORT_SIZE, 0) });
+	};
+
+	for (char character : text) {
+		if (character >= 'a' && character <= 'z') {
+			key(WEDGE_KEY_A + character - 'a', 0);
+		} else if (character >= 'A' && character <= 'Z') {
+			// left shift
+			key(WEDGE_KEY_A + character - 'A', 0x02);
+		} else if (character == '0') {
+			key(WEDGE_KEY_0, 0);
+		} else if (character >= '1' && character <= '9') {
+			key(WEDGE_KEY_1 + character - '1', 0);
+		}
+
+		// anything else has no key the wedge path understands and is left out, as a
+		// scanner would type keys the station drops
+	}
+
+	key(WEDGE_KEY_ENTER, 0);
+
+	return reports;
+}
+
+// what the wedge path makes of a symbol, only letters and digits come through
+static std::string wedgeText(const std::string &text) {
+	std::string result;
+
+	for (char character : text) {
+		if (isalnum((unsigned char)character)) {
+			result += character;
+		}
+	}
+
+	return result.substr(0, RECORD_LENGTH_LIMIT);
+}
+
+static double decodeTime(const Trace &trace) {
+	std::vector<Symbol> symbols;
+	uint32_t truncated = 0;
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (int round = 0; round < REPLAY_ROUNDS; round++) {
+		symbols.clear();
+		decode(trace, &symbols, &truncated);
+	}
+
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / REPLAY_ROUNDS / std::max<size_t>(1, symbols.size());
+}
+
+static int replay(int count, char **paths) {
+	int failures = 0;
+
+	printf("%-28s %-5s %7s %6s %9s %9s %9s %9s %9s %9s\n",
+		"trace", "mode", "symbols", "ok", "reports", "wedge", "scans/s", "wedge/s", "decode ns", "wedge ns"
+	);
+
+	for (int index = 0; index < count; index++) {
+		Trace trace;
+
+		if (!load(paths[index], &trace)) {
+			return 1;
+		}
+
+		std::vector<Symbol> symbols;
+		uint32_t truncated = 0;
+
+		if (!decode(trace, &symbols, &truncated)) {
+			printf("FAIL %s: descriptor has no POS scanned data report\n", trace.path.c_str());
+			failures++;
+
+			continue;
+		}
+
+		// every expected symbol completes at its report, and nothing else completes
+		bool ok = symbols.size() == trace.expectations.size();
+
+		for (size_t symbol = 0; symbol < symbols.size() && symbol < trace.expectations.size(); symbol++) {
+			const Expectation &expected = trace.expectations[symbol];
+			const Symbol &decoded = symbols[symbol];
+
+			bool match =
+				decoded.report == expected.report &&
+				decoded.text == expected.text &&
+				decoded.symbology == expected.symbology;
+
+			if (!match) {
+				printf("FAIL %s: symbol %zu is '%s' %s at report %zu, expected '%s' %s at report %zu\n",
+					trace.path.c_str(), symbol,
+					decoded.text.c_str(), decoded.symbology.c_str(), decoded.report,
+					expected.text.c_str(), expected.symbology.c_str(), expected.report
+				);
+			}
+
+			ok = ok && match;
+		}
+
+		if (symbols.size() != trace.expectations.size()) {
+			printf("FAIL %s: %zu symbols decoded, %zu expected\n", trace.path.c_str(), symbols.size(), trace.expectations.size());
+		}
+
+		// the same symbols typed by a wedge scanner, decoded by the station wedge path
+		Trace wedge;
+		wedge.mode = "wedge";
+
+		for (const Symbol &symbol : symbols) {
+			for (Report &report : wedgeReports(symbol.text)) {
+				wedge.reports.push_back(report);
+			}
+		}
+
+		std::vector<Symbol> typed;
+		uint32_t typedTruncated = 0;
+		decode(wedge, &typed, &typedTruncated);
+
+		bool typedOk = typed.size() == symbols.size();
+
+		for (size_t symbol = 0; typedOk && symbol < typed.size(); symbol++) {
+			typedOk = typed[symbol].text == wedgeText(symbols[symbol].text);
+		}
+
+		if (!typedOk) {
+			printf("FAIL %s: the wedge path decodes the symbols differently\n", trace.path.c_str());
+		}
+
+		ok = ok && typedOk;
+		failures += !ok;
+
+		double reports = symbols.empty() ? 0 : (double)trace.reports.size() / symbols.size();
+		double wedgeReportCount = symbols.empty() ? 0 : (double)wedge.reports.size() / symbols.size();
+
+		// one report per polling interval at best
+		double rate = reports > 0 ? 1000 / (trace.interval * reports) : 0;
+		double wedgeRate = wedgeReportCount > 0 ? 1000 / (trace.interval * wedgeReportCount) : 0;
+
+		printf("%-28s %-5s %7zu %6s %9.1f %9.1f %9.1f %9.1f %9.0f %9.0f\n",
+			trace.path.c_str(), trace.mode.c_str(), symbols.size(), ok ? "yes" : "no",
+			reports, wedgeReportCount, rate, wedgeRate,
+			decodeTime(trace), decodeTime(wedge)
+		);
+
+		if (truncated) {
+			printf("  %u symbols truncated at the record limit\n", truncated);
+		}
+
+		// what the capture itself shows, the operator sets that pace
+		if (trace.reports.size() > 1 && trace.reports.back().time > trace.reports.front().time) {
+			double seconds = (trace.reports.back().time - trace.reports.front().time) / 1e6;
+
+			printf("  captured %.1f scans/s over %.2f s\n", symbols.size() / seconds, seconds);
+		}
+	}
+
+	return failures == 0 ? 0 : 1;
+}
+
+int main(int count, char **arguments) {
+	std::string mode = count > 1 ? arguments[1] : "";
+
+	if (mode == "replay" && count > 2) {
+		return replay(count - 2, arguments + 2);
+	}
+
+	fprintf(stderr, "usage: %s replay TRACE...\n", arguments[0]);
+
+	return 1;
+}
@@ -0,0 +1,376 @@
+// scan record arena checks and benchmark
+//
+// runs the station record arena, see firmware/main/record.cpp, with mixed short and long codes
+// and the two consumers of the station releasing their references out of order
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -I../firmware/main index.cpp -o record
+//
+// usage:
+//
+//   ./record check                 round trips, truncation, padding at the ring end, overflow,
+//                                  out of order release and the 32 bit position wrap
+//   ./record benchmark [COUNT]     commits COUNT scans (200000) per workload, reports commit
+//                                  cost, overflow and truncation counts and arena use
+//
+// 2D codes past RECORD_LENGTH_LIMIT are stored cut off and flagged, uplink and lookup skip them
+//
+// the benchmark models the station consumers: the main loop holds the scan on screen until the
+// next one replaces it, the uplink holds scans until its batch is out and releases the batch
+// in any order, every released record is checked against the scan it was committed from
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+
+#include "record.cpp"
+#include "../host/check.cpp"
+
+// consumers of every station scan, as SCAN_CONSUMERS in scan.cpp
+#define CONSUMERS 2
+
+alignas(RECORD_ALIGNMENT) static uint8_t arenaMemory[RECORD_ARENA_SIZE];
+
+static std::mt19937 random32(32);
+
+static std::string code(size_t length) {
+	const char *alphabet = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+	std::string code;
+
+	for (size_t index = 0; index < length; index++) {
+		code += alphabet[random32() % 36];
+	}
+
+	return code;
+}
+
+static bool matches(const ScanRecord *record, const std::string &scan) {
+	size_t length = MIN(scan.size(), (size_t)RECORD_LENGTH_LIMIT);
+
+	return
+		record->length == length && memcmp(record->data(), scan.data(), length) == 0 && record->data()[length] == '\0' &&
+		record->truncated == (scan.size() > RECORD_LENGTH_LIMIT);
+}
+
+static void checkRoundTrip() {
+	RecordArena arena;
+	arena.begin(arenaMemory, sizeof(arenaMemory));
+
+	std::string scan = code(13);
+	ScanRecord *record = arena.commit(scan.data(), scan.size(), "]E0", 1700000000123456ull, CONSUMERS);
+
+	expect(record != NULL, "round trip", "commit failed");
+
+	if (record == NULL) {
+		return;
+	}
+
+	expect(matches(record, scan), "round trip", "data differs");
+	expect(strcmp(record->symbology, "]E0") == 0, "round trip", "symbology differs");
+	expect(record->time == 1700000000123456ull, "round trip", "time differs");
+	expect(record->references.load() == CONSUMERS, "round trip", "references");
+	expect(record->size == recordSize(scan.size()) && record->size % RECORD_ALIGNMENT == 0, "round trip", "size");
+	expect(((uintptr_t)record) % RECORD_ALIGNMENT == 0, "round trip", "record not aligned");
+
+	// a symbology longer than the field is cut, never unterminated
+	ScanRecord *longSymbology = arena.commit("1", 1, "]Q3X", 0, 1);
+	expect(longSymbology && strcmp(longSymbology->symbology, "]Q3") == 0, "round trip", "symbology not cut");
+
+	ScanRecord *empty = arena.commit("", 0, "", 0, 1);
+	expect(empty && empty->length == 0 && empty->data()[0] == '\0', "round trip", "empty scan");
+
+	expect(arena.committed == 3, "round trip", "committed count");
+}
+
+static void checkTruncation() {
+	RecordArena arena;
+	arena.begin(arenaMemory, sizeof(arenaMemory));
+
+	for (size_t length : { RECORD_LENGTH_LIMIT - 1, RECORD_LENGTH_LIMIT, RECORD_LENGTH_LIMIT + 1, RECORD_LENGTH_LIMIT * 4 }) {
+		std::string scan = code(length);
+		ScanRecord *record = arena.commit(scan.data(), scan.size(), "", 0, 1);
+
+		expect(record && matches(record, scan), "truncation", "long scan not cut at the limit");
+		expect(record && record->truncated == (length > RECORD_LENGTH_LIMIT), "truncation", "truncated flag");
+
+		if (record) {
+			recordRelease(record);
+		}
+	}
+
+	expect(arena.truncated == 2, "truncation", "truncated count");
+}
+
+// references dropped in any order, space only comes back from the oldest record on
+static void checkRelease() {
+	RecordArena arena;
+	arena.begin(arenaMemory, sizeof(arenaMemory));
+
+	std::string scan = code(100);
+
+	ScanRecord *first = arena.commit(scan.data(), scan.size(), "", 0, CONSUMERS);
+	ScanRecord *second = arena.commit(scan.data(), scan.size(), "", 0, CONSUMERS);
+	ScanRecord *third = arena.commit(scan.data(), scan.size(), "", 0, CONSUMERS);
+
+	uint32_t held = arena.used();
+
+	for (ScanRecord *record : { third, second }) {
+		recordRelease(record);
+		recordRelease(record);
+	}
+
+	// reclaim runs on commit, the oldest record still blocks the others
+	ScanRecord *probe = arena.commit("", 0, "", 0, 1);
+	expect(arena.used() == held + probe->size, "release", "space reclaimed past a held record");
+
+	recordRelease(first);
+	recordRelease(probe);
+
+	// the released probe sits behind the held record as well
+	probe = arena.commit("", 0, "", 0, 1);
+	expect(arena.used() == held + 2 * probe->size, "release", "space reclaimed with a reference left");
+
+	recordRelease(first);
+	recordRelease(probe);
+
+	probe = arena.commit("", 0, "", 0, 1);
+	expect(arena.used() == probe->size, "release", "released records not reclaimed");
+}
+
+// a record that does not fit before the ring end starts over at the front, intact
+static void checkPadding() {
+	RecordArena arena;
+	arena.begin(arenaMemory, sizeof(arenaMemory));
+
+	std::string small = code(40);
+	std::string large = code(RECORD_LENGTH_LIMIT);
+
+	std::vector<ScanRecord *> records;
+	uint32_t position = 0;
+
+	while (RECORD_ARENA_SIZE - position >= recordSize(small.size()) + recordSize(large.size()) / 2) {
+		ScanRecord *record = arena.commit(small.data(), small.size(), "", 0, 1);
+		records.push_back(record);
+		position += record->size;
+	}
+
+	// frees the front, the ring end is still short of the large record
+	for (ScanRecord *record : records) {
+		recordRelease(record);
+	}
+
+	ScanRecord *wrapped = arena.commit(large.data(), large.size(), "", 0, 1);
+
+	expect(wrapped == (ScanRecord *)arenaMemory, "padding", "record did not start over at the front");
+	expect(wrapped && matches(wrapped, large), "padding", "wrapped record differs");
+	expect(arena.used() == RECORD_ARENA_SIZE - position + recordSize(large.size()), "padding", "skipped end not counted as used");
+}
+
+static void checkOverflow() {
+	RecordArena arena;
+	arena.begin(arenaMemory, sizeof(arenaMemory));
+
+	std::string scan = code(RECORD_LENGTH_LIMIT);
+	int stored = 0;
+
+	while (arena.commit(scan.data(), scan.size(), "", 0, 1) != NULL) {
+		stored++;
+	}
+
+	expect(stored == RECORD_ARENA_SIZE / (int)recordSize(scan.size()), "overflow", "arena not filled to the end");
+	expect(arena.overflow == 1, "overflow", "overflow count");
+	expect(arena.used() <= RECORD_ARENA_SIZE, "overflow", "more used than the ring holds");
+}
+
+// running positions pass 2^32, the ring keeps working
+static void checkPositionWrap() {
+	RecordArena arena;
+	arena.begin(arenaMemory, sizeof(arenaMemory));
+
+	std::string scan = code(RECORD_LENGTH_LIMIT);
+	uint64_t total = 0;
+	ScanRecord *previous = NULL;
+	bool intact = true;
+
+	// the newest record stays held, so the tail always trails the head
+	while (total < (1ull << 32) + 4 * RECORD_ARENA_SIZE) {
+		scan[0] = 'A' + total % 26;
+
+		ScanRecord *record = arena.commit(scan.data(), scan.size(), "", 0, 1);
+
+		if (record == NULL) {
+			intact = false;
+
+			break;
+		}
+
+		intact = intact && matches(record, scan) && arena.used() <= RECORD_ARENA_SIZE;
+
+		if (previous) {
+			recordRelease(previous);
+		}
+
+		previous = record;
+		total += record->size;
+	}
+
+	expect(intact, "position wrap", "arena failed past the 32 bit wrap");
+	expect(arena.overflow == 0, "position wrap", "overflow with one record held");
+}
+
+static int check() {
+	checkRoundTrip();
+	checkTruncation();
+	checkRelease();
+	checkPadding();
+	checkOverflow();
+	checkPositionWrap();
+
+	return checkResult();
+}
+
+struct Workload {
+	const char *name;
+
+	// share of 2D codes, 80 to 400 characters, the rest are 8 to 20 character barcodes
+	double longShare;
+
+	// scans the uplink collects before its batch is out and released
+	int batch;
+};
+
+struct Held {
+	ScanRecord *record;
+	std::string scan;
+};
+
+static void run(const Workload *workload, int count) {
+	RecordArena arena;
+	arena.begin(arenaMemory, sizeof(arenaMemory));
+
+	std::vector<std::string> scans;
+
+	for (int index = 0; index < count; index++) {
+		bool isLong = random32() % 1000 < workload->longShare * 1000;
+		scans.push_back(code(isLong ? 80 + random32() % 321 : 8 + random32() % 13));
+	}
+
+	std::vector<double> costs;
+	costs.reserve(count);
+
+	Held display = { NULL, "" };
+	std::vector<Held> uplink;
+
+	uint64_t usedSum = 0;
+	uint32_t usedPeak = 0;
+	size_t heldPeak = 0;
+	uint64_t bytes = 0;
+	bool intact = true;
+
+	for (const std::string &scan : scans) {
+		auto start = std::chrono::steady_clock::now();
+		ScanRecord *record = arena.commit(scan.data(), scan.size(), "", 0, CONSUMERS);
+		auto end = std::chrono::steady_clock::now();
+
+		costs.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+
+		usedSum += arena.used();
+		usedPeak = MAX(usedPeak, arena.used());
+
+		if (record == NULL) {
+			continue;
+		}
+
+		bytes += MIN(scan.size(), (size_t)RECORD_LENGTH_LIMIT);
+		heldPeak = MAX(heldPeak, uplink.size() + 1);
+
+		// the main loop shows the new scan and lets go of the previous one
+		if (display.record) {
+			intact = intact && matches(display.record, display.scan);
+			recordRelease(display.record);
+		}
+
+		display = { record, scan };
+		uplink.push_back({ record, scan });
+
+		// the batch is out, references come back in any order
+		if ((int)uplink.size() >= workload->batch) {
+			std::shuffle(uplink.begin(), uplink.end(), random32);
+
+			for (const Held &held : uplink) {
+				intact = intact && matches(held.record, held.scan);
+				recordRelease(held.record);
+			}
+
+			uplink.clear();
+		}
+	}
+
+	expect(intact, workload->name, "released record differs from its scan");
+
+	std::sort(costs.begin(), costs.end());
+
+	double mean = 0;
+
+	for (double cost : costs) {
+		mean += cost / costs.size();
+	}
+
+	// fixed slots of the record limit for the same number of held scans
+	uint32_t fixed = heldPeak * (RECORD_LENGTH_LIMIT + 1);
+
+	printf(
+		"%-12s %6.0f ns %6.0f ns p99 %7u overflow %6u truncated %6.0f B mean %6u B peak %4zu held %7u B fixed %5.1f B/scan\n",
+		workload->name,
+		mean, costs[costs.size() * 99 / 100],
+		arena.overflow, arena.truncated,
+		(double)usedSum / count, usedPeak,
+		heldPeak, fixed,
+		(double)bytes / MAX(arena.committed, 1u)
+	);
+}
+
+static int benchmark(int count) {
+	const Workload workloads[] = {
+		{ "barcodes", 0, 8 },
+		{ "mixed", 0.1, 8 },
+		{ "2D codes", 0.6, 8 },
+		{ "mixed slow", 0.1, 64 },
+		{ "2D slow", 0.6, 64 },
+
+		// the batch never fills, the uplink is down and holds every scan
+		{ "2D outage", 0.6, 256 }
+	};
+
+	printf("%d scans per workload, %d byte arena, commit cost includes the clock read\n", count, RECORD_ARENA_SIZE);
+
+	for (const Workload &workload : workloads) {
+		run(&workload, count);
+	}
+
+	return failures == 0 ? 0 : 1;
+}
+
+int main(int count, char **arguments) {
+	std::string mode = count > 1 ? arguments[1] : "";
+
+	if (mode == "check" && count == 2) {
+		return check();
+	}
+
+	if (mode == "benchmark" && count <= 3) {
+		return benchmark(count == 3 ? atoi(arguments[2]) : 200000);
+	}
+
+	fprintf(stderr, "usage: %s check | benchmark [COUNT]\n", arguments[0]);
+
+	return 1;
+}
@@ -0,0 +1,708 @@
+// text layout and rendering checks on the host
+//
+// runs the station text code, see firmware/main/text.cpp, against the real font data
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -I../firmware/main index.cpp -o render
+//
+// usage:
+//
+//   ./render check [GOLDEN]       layout overflow, clipping, alignment and blend cases, and the
+//                                 golden canvases in GOLDEN, golden by default
+//   ./render golden [GOLDEN]      writes the golden canvases, after a deliberate rendering change
+//   ./render benchmark [COUNT]    renders tags with the previous per pixel path, the 1 bit layout
+//                                 path and the anti aliased path
+//
+// the canvas of every case sits between guard rows, any write outside of it fails the case
+//
+// golden canvases are binary PPM files, the RGB565 pixels widened to 8 bits per channel
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "text.cpp"
+#include "font/mono-40.cpp"
+#include "../host/check.cpp"
+
+// same as the tag widget
+#define CANVAS_WIDTH 460
+#define CANVAS_HEIGHT 128
+
+#define GUARD 64
+#define GUARD_COLOR 0xDEAD
+
+#define BACKGROUND 0x0000
+#define FOREGROUND 0xFFFF
+
+// packed canvas between guard rows, the renderer sees rows of exactly the canvas width
+//
+// a write past the end of a row lands in the next row, the ink checks catch those
+struct Canvas {
+	int width;
+	int height;
+
+	std::vector<uint16_t> pixels;
+
+	Canvas(int width, int height) :
+		width(width),
+		height(height),
+		pixels(width * (height + 2 * GUARD), GUARD_COLOR)
+	{
+		std::fill(this->canvas(), this->canvas() + width * height, BACKGROUND);
+	}
+
+	uint16_t *canvas() {
+		return &this->pixels[GUARD * this->width];
+	}
+
+	uint16_t *at(int x, int y) {
+		return this->canvas() + y * this->width + x;
+	}
+
+	bool guarded() {
+		for (int index = 0; index < GUARD * this->width; index++) {
+			if (this->pixels[index] != GUARD_COLOR || this->pixels[this->pixels.size() - 1 - index] != GUARD_COLOR) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// bounding box of the drawn pixels, empty when nothing was drawn
+	void ink(int *left, int *top, int *right, int *bottom) {
+		*left = this->width;
+		*top = this->height;
+		*right = 0;
+		*bottom = 0;
+
+		for (int row = 0; row < this->height; row++) {
+			for (int column = 0; column < this->width; column++) {
+				if (*this->at(column, row) != BACKGROUND) {
+					*left = MIN(*left, column);
+					*top = MIN(*top, row);
+					*right = MAX(*right, column + 1);
+					*bottom = MAX(*bottom, row + 1);
+				}
+			}
+		}
+	}
+};
+
+// layout and render in one call, with a fresh layout every time as the firmware did before
+// the split, the goldens and the benchmark draw through this
+static uint16_t drawText(
+	const Font *font,
+
+	uint16_t *canvas,
+	int canvasWidth,
+	int canvasHeight,
+
+	int x,
+	int y,
+	int maxWidth,
+
+	const char *string,
+
+	uint16_t fg,
+	uint16_t bg,
+	text_align_t align = TEXT_ALIGN_LEFT
+) {
+	TextLayout layout;
+	layoutText(&layout, font, string, maxWidth, canvasHeight - y);
+
+	drawLayout(
+		&layout,
+		canvas, canvasWidth, canvasHeight,
+		x, y, maxWidth, align,
+		fg, bg
+	);
+
+	return layout.height;
+}
+
+static void render(
+	Canvas *canvas,
+	const TextLayout *layout,
+	int x,
+	int y,
+	int width,
+	text_align_t align
+) {
+	drawLayout(
+		layout,
+		canvas->canvas(), canvas->width, canvas->height,
+		x, y, width, align,
+		FOREGROUND, BACKGROUND
+	);
+}
+
+static int measure(const char *string) {
+	int width = 0;
+
+	for (const char *character = string; *character; character++) {
+		width += glyphAdvance(&Monospace40, findGlyph(&Monospace40, *character));
+	}
+
+	return width;
+}
+
+// lines never exceed the width, nothing is dropped unless the layout says so
+static void checkLines(const char *name, const TextLayout *layout, const char *string, int maxWidth, int maxHeight) {
+	size_t length = 0;
+
+	for (uint8_t index = 0; index < layout->lineCount; index++) {
+		const TextLine *line = &layout->lines[index];
+
+		expect(line->start == string + length, name, "lines are not contiguous");
+		expect(line->length > 0, name, "empty line");
+
+		// a single glyph wider than the box still takes a line of its own
+		expect(line->width <= maxWidth || line->length == 1, name, "line wider than the box");
+
+		length += line->length;
+	}
+
+	expect(layout->truncated == (length < strlen(string)), name, "truncated does not match the lines");
+	expect(layout->height <= maxHeight, name, "layout taller than the box");
+	expect(layout->lineCount <= TEXT_LINE_LIMIT, name, "more lines than the limit");
+}
+
+static void checkCase(
+	const char *name,
+	const char *string,
+
+	int canvasWidth,
+	int canvasHeight,
+
+	int x,
+	int y,
+	int maxWidth,
+	int maxHeight,
+
+	text_align_t align
+) {
+	TextLayout layout;
+	layoutText(&layout, &Monospace40, string, maxWidth, maxHeight);
+
+	checkLines(name, &layout, string, maxWidth, maxHeight);
+
+	Canvas canvas(canvasWidth, canvasHeight);
+	render(&canvas, &layout, x, y, maxWidth, align);
+
+	expect(canvas.guarded(), name, "wrote outside the canvas");
+
+	// ink stays within the tight box the compositor invalidates, clipped to the canvas
+	int left, top, right, bottom;
+	canvas.ink(&left, &top, &right, &bottom);
+
+	if (left < right) {
+		int boxLeft = x + layoutOffset(&layout, maxWidth, align);
+		int boxTop = y;
+
+		expect(left >= MAX(boxLeft, 0) && right <= MIN(boxLeft + layout.width, canvasWidth), name, "ink outside the box horizontally");
+		expect(top >= MAX(boxTop, 0) && bottom <= MIN(boxTop + layout.lineCount * Monospace40.height, canvasHeight), name, "ink outside the box vertically");
+	}
+}
+
+// a clipped render matches the same text rendered in full and cut out afterwards
+static void checkClipping(const char *name, const char *string, int x, int y) {
+	TextLayout layout;
+	layoutText(&layout, &Monospace40, string, CANVAS_WIDTH, CANVAS_HEIGHT);
+
+	Canvas full(CANVAS_WIDTH + 2 * GUARD, CANVAS_HEIGHT + 2 * GUARD);
+	render(&full, &layout, GUARD, GUARD, CANVAS_WIDTH, TEXT_ALIGN_LEFT);
+
+	Canvas clipped(CANVAS_WIDTH, CANVAS_HEIGHT);
+	render(&clipped, &layout, x, y, CANVAS_WIDTH, TEXT_ALIGN_LEFT);
+
+	expect(clipped.guarded(), name, "wrote outside the canvas");
+
+	bool equal = true;
+
+	for (int row = 0; row < CANVAS_HEIGHT; row++) {
+		for (int column = 0; column < CANVAS_WIDTH; column++) {
+			int sourceColumn = column - x + GUARD;
+			int sourceRow = row - y + GUARD;
+
+			uint16_t expected = BACKGROUND;
+
+			if (sourceColumn >= 0 && sourceColumn < full.width && sourceRow >= 0 && sourceRow < full.height) {
+				expected = *full.at(sourceColumn, sourceRow);
+			}
+
+			equal = equal && *clipped.at(column, row) == expected;
+		}
+	}
+
+	expect(equal, name, "clipped pixels differ from the full render");
+}
+
+static void checkAlignment() {
+	const char *string = "ABC-123";
+	int width = measure(string);
+
+	TextLayout layout;
+	layoutText(&layout, &Monospace40, string, CANVAS_WIDTH, CANVAS_HEIGHT);
+
+	expect(layout.lineCount == 1 && layout.width == width, "alignment", "single line layout");
+
+	expect(lineOffset(&layout.lines[0], CANVAS_WIDTH, TEXT_ALIGN_LEFT) == 0, "alignment", "left offset");
+	expect(lineOffset(&layout.lines[0], CANVAS_WIDTH, TEXT_ALIGN_RIGHT) == CANVAS_WIDTH - width, "alignment", "right offset");
+	expect(lineOffset(&layout.lines[0], CANVAS_WIDTH, TEXT_ALIGN_CENTER) == (CANVAS_WIDTH - width) / 2, "alignment", "center offset");
+
+	// a line as wide as the box has no space to distribute
+	expect(lineOffset(&layout.lines[0], width, TEXT_ALIGN_RIGHT) == 0, "alignment", "full line offset");
+
+	// lines of a wrapped text are aligned one by one, the box starts at the widest
+	layoutText(&layout, &Monospace40, "WWWWWWWWWWWWWWWWWWWWWWWWW", CANVAS_WIDTH, CANVAS_HEIGHT);
+
+	expect(layout.lineCount == 2, "alignment", "wrapped layout");
+	expect(layoutOffset(&layout, CANVAS_WIDTH, TEXT_ALIGN_RIGHT) == CANVAS_WIDTH - layout.width, "alignment", "wrapped box offset");
+}
+
+static void checkLayout() {
+	TextLayout layout;
+
+	layoutText(&layout, &Monospace40, "", CANVAS_WIDTH, CANVAS_HEIGHT);
+	expect(layout.lineCount == 0 && layout.width == 0 && layout.height == 0 && !layout.truncated, "empty", "empty layout");
+
+	// characters without a glyph take a square of the font height
+	layoutText(&layout, &Monospace40, "\x01", CANVAS_WIDTH, CANVAS_HEIGHT);
+	expect(layout.width == Monospace40.height, "missing glyph", "missing glyph advance");
+
+	// one glyph wider than the box cannot wrap, it is clipped instead
+	layoutText(&layout, &Monospace40, "WW", 4, CANVAS_HEIGHT);
+	expect(layout.lineCount == 2 && layout.width == 4, "narrow box", "one glyph per line, width clipped");
+
+	// the line limit holds for any height
+	std::string longest(400, '8');
+	layoutText(&layout, &Monospace40, longest.c_str(), CANVAS_WIDTH, 100000);
+	expect(layout.lineCount == TEXT_LINE_LIMIT && layout.truncated, "line limit", "line limit");
+
+	// a partial last line is laid out, the height is cut at the box
+	layoutText(&layout, &Monospace40, longest.c_str(), CANVAS_WIDTH, Monospace40.height + 1);
+	expect(layout.lineCount == 2 && layout.height == Monospace40.height + 1, "partial line", "partial line");
+
+	// no room for any line
+	layoutText(&layout, &Monospace40, "A", CANVAS_WIDTH, 0);
+	expect(layout.lineCount == 0 && layout.truncated, "no height", "no line in a box without height");
+}
+
+// the same glyphs without coverage, drawn through the 1 bit path
+static const Font *bitmapFont() {
+	static std::vector<Glyph> glyphs(Monospace40.glyphs, Monospace40.glyphs + Monospace40.glyphCount);
+	static Font font = { Monospace40.height, glyphs.data(), Monospace40.glyphCount };
+
+	for (Glyph &glyph : glyphs) {
+		glyph.coverage = NULL;
+		glyph.coverageCount = 0;
+	}
+
+	return &font;
+}
+
+// every glyph of the font carries coverage that covers its box exactly
+static void checkCoverage() {
+	for (uint8_t index = 0; index < Monospace40.glyphCount; index++) {
+		const Glyph *glyph = &Monospace40.glyphs[index];
+		uint32_t pixels = 0;
+
+		uint16_t run = 0;
+		uint8_t level;
+
+		while (run < glyph->coverageCount) {
+			pixels += glyphRun(glyph, &run, &level);
+		}
+
+		char name[32];
+		snprintf(name, sizeof(name), "coverage '%c'", glyph->character);
+
+		expect(glyph->coverage != NULL, name, "glyph without coverage");
+		expect(pixels == (uint32_t)glyph->width * Monospace40.height, name, "runs do not cover the glyph box");
+	}
+}
+
+// the table ends are the exact colours and every channel moves towards the foreground
+static void checkBlend() {
+	const uint16_t pairs[][2] = {
+		{ FOREGROUND, BACKGROUND },
+		{ BACKGROUND, FOREGROUND },
+		{ rgb(255, 0, 0), rgb(0, 0, 0) },
+		{ rgb(30, 200, 90), rgb(200, 40, 250) }
+	};
+
+	for (const auto &pair : pairs) {
+		const uint16_t *blend = findBlend(pair[0], pair[1]);
+
+		expect(blend[0] == pair[1], "blend", "no coverage is not the background");
+		expect(blend[BLEND_LEVELS - 1] == pair[0], "blend", "full coverage is not the foreground");
+
+		for (uint8_t level = 1; level < BLEND_LEVELS; level++) {
+			for (int shift : { 11, 5, 0 }) {
+				int mask = shift == 5 ? 0x3F : 0x1F;
+
+				int fg = (pair[0] >> shift) & mask;
+				int previous = (blend[level - 1] >> shift) & mask;
+				int current = (blend[level] >> shift) & mask;
+
+				expect(abs(fg - current) <= abs(fg - previous), "blend", "channel moves away from the foreground");
+			}
+		}
+	}
+
+	// more pairs than the cache holds, every table stays correct after replacement
+	for (int round = 0; round < 2; round++) {
+		for (uint8_t red = 0; red < BLEND_CACHE_SIZE + 3; red++) {
+			const uint16_t *blend = findBlend(rgb(red * 20, 0, 0), BACKGROUND);
+
+			expect(blend[BLEND_LEVELS - 1] == rgb(red * 20, 0, 0) && blend[0] == BACKGROUND, "blend cache", "replaced table");
+		}
+	}
+}
+
+struct Golden {
+	const char *name;
+	const char *text;
+
+	uint16_t fg;
+	uint16_t bg;
+
+	bool antialiased;
+};
+
+// a tag in each widget colour, the hold answer, dark text on light and the 1 bit path
+static const Golden goldens[] = {
+	{ "tag", "TAG-0042", FOREGROUND, BACKGROUND, true },
+	{ "tag-1bit", "TAG-0042", FOREGROUND, BACKGROUND, false },
+	{ "family", "1Z999AA1", rgb(0, 180, 255), BACKGROUND, true },
+	{ "hold", "GATE-7:hold", rgb(255, 0, 0), BACKGROUND, true },
+	{ "inverse", "jx_q,.;W", BACKGROUND, FOREGROUND, true }
+};
+
+static std::vector<uint8_t> renderGolden(const Golden *golden, int *width, int *height) {
+	const Font *font = golden->antialiased ? &Monospace40 : bitmapFont();
+
+	*width = measure(golden->text);
+	*height = font->height;
+
+	std::vector<uint16_t> canvas(*width * *height, golden->bg);
+	drawText(font, canvas.data(), *width, *height, 0, 0, *width, golden->text, golden->fg, golden->bg);
+
+	// the channels are widened by repeating their high bits, so the conversion is exact
+	std::vector<uint8_t> pixels;
+
+	for (uint16_t pixel : canvas) {
+		uint8_t red = pixel >> 11;
+		uint8_t green = (pixel >> 5) & 0x3F;
+		uint8_t blue = pixel & 0x1F;
+
+		pixels.push_back((red << 3) | (red >> 2));
+		pixels.push_back((green << 2) | (green >> 4));
+		pixels.push_back((blue << 3) | (blue >> 2));
+	}
+
+	return pixels;
+}
+
+static std::string goldenPath(const char *directory, const Golden *golden) {
+	return std::string(directory) + "/" + golden->name + ".ppm";
+}
+
+static void checkGoldens(const char *directory) {
+	for (const Golden &golden : goldens) {
+		int width, height;
+		std::vector<uint8_t> pixels = renderGolden(&golden, &width, &height);
+
+		std::string path = goldenPath(directory, &golden);
+		FILE *file = fopen(path.c_str(), "rb");
+
+		if (file == NULL) {
+			expect(false, golden.name, "golden canvas missing");
+
+			continue;
+		}
+
+		int fileWidth = 0;
+		int fileHeight = 0;
+		int depth = 0;
+
+		bool header = fscanf(file, "P6 %d %d %d", &fileWidth, &fileHeight, &depth) == 3 && fgetc(file) == '\n';
+
+		std::vector<uint8_t> expected(pixels.size());
+		bool read = header && fileWidth == width && fileHeight == height && depth == 255 &&
+			fread(expected.data(), 1, expected.size(), file) == expected.size();
+
+		fclose(file);
+
+		expect(read, golden.name, "golden canvas has a different size");
+
+		if (!read) {
+			continue;
+		}
+
+		int differences = 0;
+
+		for (size_t index = 0; index < pixels.size(); index += 3) {
+			differences += memcmp(&pixels[index], &expected[index], 3) != 0;
+		}
+
+		if (differences) {
+			printf("FAIL %s: %d of %d pixels differ from %s\n", golden.name, differences, width * height, path.c_str());
+			failures++;
+		}
+	}
+}
+
+static int writeGoldens(const char *directory) {
+	for (const Golden &golden : goldens) {
+		int width, height;
+		std::vector<uint8_t> pixels = renderGolden(&golden, &width, &height);
+
+		std::string path = goldenPath(directory, &golden);
+		FILE *file = fopen(path.c_str(), "wb");
+
+		if (file == NULL) {
+			perror(path.c_str());
+
+			return 1;
+		}
+
+		fprintf(file, "P6\n%d %d\n255\n", width, height);
+		fwrite(pixels.data(), 1, pixels.size(), file);
+		fclose(file);
+
+		printf("%s %dx%d\n", path.c_str(), width, height);
+	}
+
+	return 0;
+}
+
+static int check(const char *goldenDirectory) {
+	checkLayout();
+	checkAlignment();
+	checkCoverage();
+	checkBlend();
+	checkGoldens(goldenDirectory);
+
+	std::string wide(60, 'W');
+	std::string mixed = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-\x01\x7f abc";
+
+	checkCase("fits", "TAG-0042", CANVAS_WIDTH, CANVAS_HEIGHT, 0, 0, CANVAS_WIDTH, CANVAS_HEIGHT, TEXT_ALIGN_LEFT);
+	checkCase("wider than the box", wide.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, 0, 0, CANVAS_WIDTH, CANVAS_HEIGHT, TEXT_ALIGN_LEFT);
+	checkCase("narrower box", wide.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, 10, 0, 120, CANVAS_HEIGHT, TEXT_ALIGN_CENTER);
+	checkCase("taller than the canvas", mixed.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, 0, 0, CANVAS_WIDTH, 1000, TEXT_ALIGN_RIGHT);
+	checkCase("box past the right edge", wide.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, 300, 0, CANVAS_WIDTH, CANVAS_HEIGHT, TEXT_ALIGN_LEFT);
+	checkCase("box past the bottom edge", mixed.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, 0, 100, CANVAS_WIDTH, 400, TEXT_ALIGN_LEFT);
+	checkCase("box before the left edge", mixed.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, -200, 0, CANVAS_WIDTH, CANVAS_HEIGHT, TEXT_ALIGN_CENTER);
+	checkCase("box above the top edge", mixed.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, 0, -70, CANVAS_WIDTH, CANVAS_HEIGHT, TEXT_ALIGN_LEFT);
+	checkCase("box outside the canvas", mixed.c_str(), CANVAS_WIDTH, CANVAS_HEIGHT, CANVAS_WIDTH + 5, -400, CANVAS_WIDTH, CANVAS_HEIGHT, TEXT_ALIGN_LEFT);
+	checkCase("tiny canvas", mixed.c_str(), 7, 3, -3, -10, 200, 200, TEXT_ALIGN_LEFT);
+
+	checkClipping("clip left", "WAVE-8", -13, 0);
+	checkClipping("clip top", "WAVE-8", 0, -17);
+	checkClipping("clip right", "WAVE-8\x01", 360, 20);
+	checkClipping("clip bottom", "WAVE-8\x01", 7, 100);
+	checkClipping("clip corner", "ABCDEFGHIJKLMNOPQRSTUVWXYZ", -101, -45);
+	checkClipping("clip descenders", "gjpqy,;", -5, -30);
+
+	return checkResult();
+}
+
+// the path before the layout pass, every glyph pixel written, background included, and no
+// clipping, ESP_LOGI per character removed
+static uint8_t previousCharacter(
+	const Font *font,
+	const Glyph *glyph,
+
+	uint16_t *canvas,
+	int canvasWidth,
+
+	int x,
+	int y,
+
+	uint16_t fg,
+	uint16_t bg
+) {
+	if (glyph == NULL) {
+		for (int row = 0; row < font->height; row++) {
+			for (int column = 0; column < font->height; column++) {
+				canvas[(y + row) * canvasWidth + x + column] = fg;
+			}
+		}
+
+		return font->height;
+	}
+
+	bool state = false;
+	uint8_t row = 0;
+	uint8_t column = 0;
+
+	for (uint8_t segmentIndex = 0; segmentIndex < glyph->segmentCount; segmentIndex++) {
+		for (uint16_t index = 0; index < glyph->segments[segmentIndex]; index++) {
+			canvas[(y + row) * canvasWidth + x + column] = state ? fg : bg;
+
+			column++;
+
+			if (column == glyph->width) {
+				column = 0;
+				row++;
+			}
+		}
+
+		state = !state;
+	}
+
+	return glyph->width;
+}
+
+static uint16_t previousText(
+	const Font *font,
+
+	uint16_t *canvas,
+	int canvasWidth,
+
+	int x,
+	int y,
+	int maxWidth,
+
+	const char *string,
+
+	uint16_t fg,
+	uint16_t bg
+) {
+	uint16_t advance = 0;
+	uint16_t line = 0;
+
+	while (*string) {
+		const Glyph *glyph = searchGlyph(font, *string);
+		uint8_t characterWidth = glyph == NULL ? font->height : glyph->width;
+
+		if (characterWidth + advance > maxWidth) {
+			advance = 0;
+			line++;
+		}
+
+		advance += previousCharacter(
+			font, glyph,
+			canvas, canvasWidth,
+			x + advance, y + line * font->height,
+			fg, bg
+		);
+
+		string++;
+	}
+
+	return line * font->height + font->height;
+}
+
+// tags as the scanner delivers them, at most two lines so the previous path stays in bounds
+static std::vector<std::string> tags(int count) {
+	std::mt19937 random(7);
+	std::vector<std::string> tags;
+
+	const char *alphabet = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+	for (int index = 0; index < count; index++) {
+		int length = 6 + random() % 20;
+		std::string tag;
+
+		for (int character = 0; character < length; character++) {
+			tag += alphabet[random() % 36];
+		}
+
+		tags.push_back(tag);
+	}
+
+	return tags;
+}
+
+// renders every sample and returns the time per tag in microseconds
+template <typename Render>
+static double timeRender(const std::vector<std::string> &samples, std::vector<uint16_t> *canvas, uint64_t *checksum, Render render) {
+	// every path clears the canvas first, as the frame did before and the compositor does now
+	auto start = std::chrono::steady_clock::now();
+
+	for (const std::string &tag : samples) {
+		std::fill(canvas->begin(), canvas->end(), BACKGROUND);
+		render(tag.c_str());
+
+		*checksum += (*canvas)[CANVAS_WIDTH * 20 + 20];
+	}
+
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::micro>(end - start).count() / samples.size();
+}
+
+static int benchmark(int count) {
+	std::vector<std::string> samples = tags(count);
+	std::vector<uint16_t> canvas(CANVAS_WIDTH * CANVAS_HEIGHT);
+
+	const Font *bitmap = bitmapFont();
+	uint64_t checksum = 0;
+
+	double previous = timeRender(samples, &canvas, &checksum, [&](const char *tag) {
+		previousText(&Monospace40, canvas.data(), CANVAS_WIDTH, 0, 0, CANVAS_WIDTH, tag, FOREGROUND, BACKGROUND);
+	});
+
+	double single = timeRender(samples, &canvas, &checksum, [&](const char *tag) {
+		drawText(bitmap, canvas.data(), CANVAS_WIDTH, CANVAS_HEIGHT, 0, 0, CANVAS_WIDTH, tag, FOREGROUND, BACKGROUND);
+	});
+
+	double antialiased = timeRender(samples, &canvas, &checksum, [&](const char *tag) {
+		drawText(&Monospace40, canvas.data(), CANVAS_WIDTH, CANVAS_HEIGHT, 0, 0, CANVAS_WIDTH, tag, FOREGROUND, BACKGROUND);
+	});
+
+	// the canvas fill alone, the same for all paths
+	double clear = timeRender(samples, &canvas, &checksum, [](const char *) {});
+
+	printf("%d tags, %.1f characters on average\n", count, [&]() {
+		size_t characters = 0;
+
+		for (const std::string &tag : samples) {
+			characters += tag.size();
+		}
+
+		return (double)characters / count;
+	}());
+
+	printf("canvas fill        %8.2f us per tag\n", clear);
+	printf("previous path      %8.2f us per tag, %.2f us without the fill\n", previous, previous - clear);
+	printf("1 bit layout path  %8.2f us per tag, %.2f us without the fill\n", single, single - clear);
+	printf("anti aliased path  %8.2f us per tag, %.2f us without the fill\n", antialiased, antialiased - clear);
+	printf("layout speedup     %8.2fx without the fill\n", (previous - clear) / (single - clear));
+	printf("anti aliasing cost %8.2fx the 1 bit layout path without the fill\n", (antialiased - clear) / (single - clear));
+
+	// keeps the renders from being optimized out
+	fprintf(stderr, "checksum %llu\n", (unsigned long long)checksum);
+
+	return 0;
+}
+
+int main(int count, char **arguments) {
+	std::string mode = count > 1 ? arguments[1] : "";
+
+	if (mode == "check" && count <= 3) {
+		return check(count == 3 ? arguments[2] : "golden");
+	}
+
+	if (mode == "golden" && count <= 3) {
+		return writeGoldens(count == 3 ? arguments[2] : "golden");
+	}
+
+	if (mode == "benchmark" && count <= 3) {
+		return benchmark(count == 3 ? atoi(arguments[2]) : 20000);
+	}
+
+	fprintf(stderr, "usage: %s check [GOLDEN] | golden [GOLDEN] | benchmark [COUNT]\n", arguments[0]);
+
+	return 1;
+}
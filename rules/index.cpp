@@ -0,0 +1,554 @@
+// tag rules compiler
+//
+// turns a rules file into the flash table used by classifyTag, see tags.rules for the format
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -I../firmware/main index.cpp -o rules
+//
+// usage:
+//
+//   ./rules compile FILE          writes the table to stdout
+//   ./rules benchmark RULES       compiles random rules and compares the table to matching rule by rule
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "classify.cpp"
+#include "record.cpp"
+
+// pattern elements besides literal characters
+#define ELEMENT_DIGIT 256
+#define ELEMENT_ANY 257
+
+#define STATE_LIMIT 65535
+
+// no prefix rule matched yet
+#define NO_MATCH INT32_MAX
+
+struct Family {
+	std::string name;
+	uint16_t color;
+	tag_priority_t priority;
+};
+
+struct Rule {
+	std::vector<int> elements;
+
+	// a trailing *, the rule matches as soon as all elements did
+	bool prefix;
+
+	int family;
+};
+
+struct Rules {
+	std::vector<Family> families;
+	std::vector<Rule> rules;
+};
+
+// the compiled automaton, as written to flash
+struct Table {
+	uint8_t classes[256];
+	uint8_t classCount = 0;
+
+	std::vector<uint16_t> transitions;
+	std::vector<uint8_t> results;
+};
+
+static uint16_t rgb(int r, int g, int b) {
+	return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xFF) >> 3));
+}
+
+static bool parsePattern(const std::string &text, Rule *rule) {
+	rule->prefix = false;
+
+	for (size_t index = 0; index < text.size(); index++) {
+		char character = text[index];
+
+		if (character == '*') {
+			if (index != text.size() - 1) {
+				return false;
+			}
+
+			rule->prefix = true;
+		} else if (character == '#') {
+			rule->elements.push_back(ELEMENT_DIGIT);
+		} else if (character == '?') {
+			rule->elements.push_back(ELEMENT_ANY);
+		} else {
+			// letters match either case, keyboard wedge scanners without shift type lower case
+			rule->elements.push_back(toupper((uint8_t)character));
+		}
+	}
+
+	return rule->elements.size() <= RECORD_LENGTH_LIMIT;
+}
+
+static bool parseRules(std::istream &input, Rules *rules) {
+	std::map<std::string, int> families;
+	std::string line;
+	int number = 0;
+
+	while (std::getline(input, line)) {
+		number++;
+
+		std::istringstream words(line);
+		std::string first;
+
+		// comments start with a lone #, a pattern may start with one
+		if (!(words >> first) || first == "#") {
+			continue;
+		}
+
+		if (first == "family") {
+			Family family;
+			std::string priority;
+			int r, g, b;
+
+			if (!(words >> family.name >> r >> g >> b >> priority)) {
+				fprintf(stderr, "line %d: expected family NAME RED GREEN BLUE PRIORITY\n", number);
+
+				return false;
+			}
+
+			family.color = rgb(r, g, b);
+
+			if (priority == "low") {
+				family.priority = TAG_PRIORITY_LOW;
+			} else if (priority == "normal") {
+				family.priority = TAG_PRIORITY_NORMAL;
+			} else if (priority == "high") {
+				family.priority = TAG_PRIORITY_HIGH;
+			} else {
+				fprintf(stderr, "line %d: unknown priority %s\n", number, priority.c_str());
+
+				return false;
+			}
+
+			families[family.name] = rules->families.size();
+			rules->families.push_back(family);
+
+			continue;
+		}
+
+		Rule rule;
+		std::string family;
+
+		if (!(words >> family) || !families.count(family)) {
+			fprintf(stderr, "line %d: expected PATTERN FAMILY with a declared family\n", number);
+
+			return false;
+		}
+
+		if (!parsePattern(first, &rule)) {
+			fprintf(stderr, "line %d: invalid pattern %s\n", number, first.c_str());
+
+			return false;
+		}
+
+		rule.family = families[family];
+		rules->rules.push_back(rule);
+	}
+
+	if (rules->families.size() > TAG_RESULT_FAMILY) {
+		fprintf(stderr, "more than %d families\n", TAG_RESULT_FAMILY);
+
+		return false;
+	}
+
+	return true;
+}
+
+static bool elementMatches(int element, uint8_t character) {
+	if (element == ELEMENT_ANY) {
+		return true;
+	}
+
+	if (element == ELEMENT_DIGIT) {
+		return character >= '0' && character <= '9';
+	}
+
+	return element == toupper(character);
+}
+
+// the reference: every rule in order
+static uint8_t matchRules(const Rules &rules, const char *tag, size_t length) {
+	for (const Rule &rule : rules.rules) {
+		size_t size = rule.elements.size();
+
+		if (length < size || (!rule.prefix && length != size)) {
+			continue;
+		}
+
+		bool matches = true;
+
+		for (size_t index = 0; index < size && matches; index++) {
+			matches = elementMatches(rule.elements[index], tag[index]);
+		}
+
+		if (matches) {
+			return rule.family + 1;
+		}
+	}
+
+	return 0;
+}
+
+// automaton state: rules still in progress, as rule << 16 | position, and the best prefix match
+typedef std::pair<std::vector<uint64_t>, int32_t> StateKey;
+
+// applies completed prefix rules, drops rules that can no longer win
+static void normalize(const Rules &rules, StateKey *key) {
+	for (uint64_t alive : key->first) {
+		const Rule &rule = rules.rules[alive >> 16];
+
+		if (rule.prefix && (alive & 0xffff) == rule.elements.size()) {
+			key->second = std::min(key->second, (int32_t)(alive >> 16));
+		}
+	}
+
+	std::vector<uint64_t> kept;
+
+	for (uint64_t alive : key->first) {
+		const Rule &rule = rules.rules[alive >> 16];
+
+		if ((int32_t)(alive >> 16) < key->second && !(rule.prefix && (alive & 0xffff) == rule.elements.size())) {
+			kept.push_back(alive);
+		}
+	}
+
+	key->first.swap(kept);
+}
+
+static uint8_t stateResult(const Rules &rules, const StateKey &key) {
+	int32_t best = key.second;
+
+	for (uint64_t alive : key.first) {
+		const Rule &rule = rules.rules[alive >> 16];
+
+		if ((alive & 0xffff) == rule.elements.size()) {
+			best = std::min(best, (int32_t)(alive >> 16));
+		}
+	}
+
+	uint8_t result = best == NO_MATCH ? 0 : rules.rules[best].family + 1;
+
+	return key.first.empty() ? result | TAG_RESULT_FINAL : result;
+}
+
+static bool compileRules(const Rules &rules, Table *table) {
+	// characters used literally get a class each, the other digits and the rest share one
+	std::vector<uint8_t> representatives;
+	bool literal[256] = {};
+
+	for (const Rule &rule : rules.rules) {
+		for (int element : rule.elements) {
+			if (element < 256) {
+				literal[element] = true;
+			}
+		}
+	}
+
+	int digitClass = -1;
+	int otherClass = -1;
+
+	for (int character = 0; character < 256; character++) {
+		// lower case shares the class of upper case, assigned earlier in the loop
+		if (character >= 'a' && character <= 'z') {
+			table->classes[character] = table->classes[toupper(character)];
+
+			continue;
+		}
+
+		bool digit = character >= '0' && character <= '9';
+		int *shared = digit ? &digitClass : &otherClass;
+
+		if (!literal[character] && *shared >= 0) {
+			table->classes[character] = *shared;
+
+			continue;
+		}
+
+		if (!literal[character]) {
+			*shared = representatives.size();
+		}
+
+		table->classes[character] = representatives.size();
+		representatives.push_back(character);
+	}
+
+	if (representatives.size() > 255) {
+		fprintf(stderr, "too many character classes\n");
+
+		return false;
+	}
+
+	table->classCount = representatives.size();
+
+	std::map<StateKey, uint16_t> states;
+	std::vector<StateKey> pending;
+
+	StateKey start;
+	start.second = NO_MATCH;
+
+	for (size_t index = 0; index < rules.rules.size(); index++) {
+		start.first.push_back((uint64_t)index << 16);
+	}
+
+	normalize(rules, &start);
+
+	states[start] = 0;
+	pending.push_back(start);
+
+	// breadth first, state ids follow discovery order
+	for (size_t id = 0; id < pending.size(); id++) {
+		StateKey key = pending[id];
+
+		table->results.push_back(stateResult(rules, key));
+
+		for (uint8_t representative : representatives) {
+			StateKey next;
+			next.second = key.second;
+
+			for (uint64_t alive : key.first) {
+				const Rule &rule = rules.rules[alive >> 16];
+				uint16_t position = alive & 0xffff;
+
+				if (position < rule.elements.size() && elementMatches(rule.elements[position], representative)) {
+					next.first.push_back(alive + 1);
+				}
+			}
+
+			normalize(rules, &next);
+
+			auto found = states.find(next);
+
+			if (found == states.end()) {
+				if (states.size() == STATE_LIMIT) {
+					fprintf(stderr, "more than %d states\n", STATE_LIMIT);
+
+					return false;
+				}
+
+				found = states.emplace(next, states.size()).first;
+				pending.push_back(next);
+			}
+
+			table->transitions.push_back(found->second);
+		}
+	}
+
+	return true;
+}
+
+static TagTable tableOf(const Rules &rules, const Table &table, std::vector<TagFamily> *families) {
+	for (const Family &family : rules.families) {
+		families->push_back({ family.name.c_str(), family.color, family.priority });
+	}
+
+	return {
+		families->data(), (uint8_t)families->size(),
+		table.classes, table.classCount,
+		table.transitions.data(),
+		table.results.data(), (uint16_t)table.results.size()
+	};
+}
+
+template <typename T>
+static void writeArray(const char *type, const char *name, const T *values, size_t count) {
+	printf("static const %s %s[] = {", type, name);
+
+	for (size_t index = 0; index < count; index++) {
+		printf(index % 16 ? " %u," : "\n\t%u,", (unsigned)values[index]);
+	}
+
+	printf("\n};\n\n");
+}
+
+static int compile(const char *path) {
+	std::ifstream file(path);
+	Rules rules;
+	Table table;
+
+	if (!file || !parseRules(file, &rules) || !compileRules(rules, &table)) {
+		fprintf(stderr, "unable to compile %s\n", path);
+
+		return 1;
+	}
+
+	const char *priorities[] = { "TAG_PRIORITY_LOW", "TAG_PRIORITY_NORMAL", "TAG_PRIORITY_HIGH" };
+
+	printf("#pragma once\n\n");
+	printf("#include \"classify.cpp\"\n\n");
+	printf("// generated by /rules/index.cpp from %s\n", path);
+	printf("//\n");
+	printf("// %zu rules, %zu states, %u character classes\n", rules.rules.size(), table.results.size(), table.classCount);
+	printf("//\n");
+
+	printf("static const TagFamily tagFamilies[] = {\n");
+
+	for (const Family &family : rules.families) {
+		printf("\t{ \"%s\", 0x%04x, %s },\n", family.name.c_str(), family.color, priorities[family.priority]);
+	}
+
+	printf("};\n\n");
+
+	writeArray("uint8_t", "tagClasses", table.classes, 256);
+	writeArray("uint16_t", "tagTransitions", table.transitions.data(), table.transitions.size());
+	writeArray("uint8_t", "tagResults", table.results.data(), table.results.size());
+
+	printf(
+		"static const TagTable tagRules = { tagFamilies, %zu, tagClasses, %u, tagTransitions, tagResults, %zu };\n",
+		rules.families.size(), table.classCount, table.results.size()
+	);
+
+	return 0;
+}
+
+// random rules in the shape of real ones: a short letter prefix, then digits, wildcards or a *
+static void randomRules(int count, std::mt19937 *random, Rules *rules) {
+	const char *names[] = { "pallet", "parcel", "tote", "badge" };
+
+	for (int index = 0; index < 4; index++) {
+		rules->families.push_back({ names[index], (uint16_t)(*random)(), (tag_priority_t)(index % 3) });
+	}
+
+	for (int index = 0; index < count; index++) {
+		Rule rule;
+		rule.family = (*random)() % 4;
+		rule.prefix = (*random)() % 4 == 0;
+
+		int letters = 1 + (*random)() % 4;
+
+		for (int letter = 0; letter < letters; letter++) {
+			rule.elements.push_back('A' + (*random)() % 26);
+		}
+
+		int digits = rule.prefix ? (*random)() % 4 : 4 + (*random)() % 10;
+
+		for (int digit = 0; digit < digits; digit++) {
+			rule.elements.push_back((*random)() % 8 == 0 ? ELEMENT_ANY : ELEMENT_DIGIT);
+		}
+
+		rules->rules.push_back(rule);
+	}
+}
+
+// a tag for a random rule, or random noise
+static std::string randomTag(const Rules &rules, std::mt19937 *random) {
+	std::string tag;
+
+	if ((*random)() % 4 == 0) {
+		int length = 4 + (*random)() % 16;
+
+		for (int index = 0; index < length; index++) {
+			tag.push_back('0' + (*random)() % 43);
+		}
+
+		return tag;
+	}
+
+	const Rule &rule = rules.rules[(*random)() % rules.rules.size()];
+
+	for (int element : rule.elements) {
+		char character = element < 256 ? element : '0' + (*random)() % 10;
+
+		// both cases, as wedge and POS scanners deliver them
+		tag.push_back((*random)() % 2 ? tolower(character) : character);
+	}
+
+	if (rule.prefix) {
+		tag.append(std::to_string((*random)()));
+	}
+
+	return tag;
+}
+
+static int benchmark(int count) {
+	std::mt19937 random(1);
+	Rules rules;
+	Table table;
+
+	randomRules(count, &random, &rules);
+
+	auto start = std::chrono::steady_clock::now();
+
+	if (!compileRules(rules, &table)) {
+		return 1;
+	}
+
+	double compileTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::vector<TagFamily> families;
+	TagTable tagTable = tableOf(rules, table, &families);
+
+	std::vector<std::string> tags;
+
+	for (int index = 0; index < 100000; index++) {
+		tags.push_back(randomTag(rules, &random));
+	}
+
+	// the table has to agree with the rules
+	for (const std::string &tag : tags) {
+		if (classifyTag(&tagTable, tag.data(), tag.size()) != matchRules(rules, tag.data(), tag.size())) {
+			fprintf(stderr, "mismatch for %s\n", tag.c_str());
+
+			return 1;
+		}
+	}
+
+	uint32_t checksum = 0;
+
+	start = std::chrono::steady_clock::now();
+
+	for (int round = 0; round < 10; round++) {
+		for (const std::string &tag : tags) {
+			checksum += classifyTag(&tagTable, tag.data(), tag.size());
+		}
+	}
+
+	double tableTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / 10;
+
+	start = std::chrono::steady_clock::now();
+
+	for (const std::string &tag : tags) {
+		checksum += matchRules(rules, tag.data(), tag.size());
+	}
+
+	double rulesTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	size_t bytes = sizeof(table.classes) + table.transitions.size() * sizeof(uint16_t) + table.results.size();
+
+	printf("%d rules: %zu states, %u classes, %zu bytes, compiled in %.0f ms\n",
+		count, table.results.size(), table.classCount, bytes, compileTime * 1000
+	);
+	printf("table %.0f ns per tag, rule by rule %.0f ns per tag (checksum %u)\n",
+		tableTime * 1e9 / tags.size(), rulesTime * 1e9 / tags.size(), checksum
+	);
+
+	return 0;
+}
+
+int main(int count, char **arguments) {
+	if (count == 3 && std::string(arguments[1]) == "compile") {
+		return compile(arguments[2]);
+	}
+
+	if (count == 3 && std::string(arguments[1]) == "benchmark") {
+		return benchmark(atoi(arguments[2]));
+	}
+
+	fprintf(stderr, "usage: %s compile FILE | benchmark RULES\n", arguments[0]);
+
+	return 1;
+}
@@ -0,0 +1,992 @@
+// multi station load simulator
+//
+// runs thousands of virtual stations on one event loop against a collector, every station
+// stores its scans in the firmware record arena and sends them with the firmware batch
+// encoder, so the traffic matches real stations
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -pthread -I../firmware/main index.cpp -o simulator
+//
+// usage:
+//
+//   ./simulator [options]
+//
+//   --stations N        virtual stations (1000)
+//   --duration S        run time in seconds (30)
+//   --rate R            scans per second per station (5)
+//   --burst N           scans per burst, bursts keep the average rate (1)
+//   --trace FILE        replay tags from a file, one per line, instead of serials
+//   --collector H:P     external collector, the built in stand-in is used otherwise
+//   --fail-every S      mean time between link failures per station, 0 for never (0)
+//   --fail-for S        link down time after a failure (2)
+//   --outage-at S       every link fails at once, 0 for never (0)
+//   --outage-for S      length of that outage (5)
+//   --retry MS          reconnect interval, UPLINK_RETRY_MS on the station (1000)
+//
+// scans are classified with the station rules, firmware/main/rules/tags.cpp, and queued and
+// batched by their priority as in uplink.cpp, serials match no rule, a trace of real tags
+// shows the priorities, the collector stand-in reports latency per priority
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+
+#include "record.cpp"
+#include "batch.cpp"
+#include "rules/tags.cpp"
+
+struct Options {
+	int stations = 1000;
+	double duration = 30;
+	double rate = 5;
+	int burst = 1;
+
+	std::string trace;
+	std::string collector;
+
+	double failEvery = 0;
+	double failFor = 2;
+	double outageAt = 0;
+	double outageFor = 5;
+	int retry = 1000;
+};
+
+static Options options;
+static std::vector<std::string> trace;
+
+static const auto startTime = std::chrono::steady_clock::now();
+
+// shared clock of stations and collector, milliseconds
+static int64_t now() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - startTime
+	).count();
+}
+
+static void nonBlocking(int descriptor) {
+	fcntl(descriptor, F_SETFL, fcntl(descriptor, F_GETFL) | O_NONBLOCK);
+}
+
+static int percentileOf(std::vector<uint32_t> &values, double percentile) {
+	if (values.empty()) {
+		return 0;
+	}
+
+	size_t index = std::min(values.size() - 1, (size_t)(percentile * values.size()));
+	std::nth_element(values.begin(), values.begin() + index, values.end());
+
+	return values[index];
+}
+
+// collector stand-in, decodes batches and measures scan to delivery latency
+class Collector {
+	public:
+		uint16_t port = 0;
+
+		std::atomic<uint64_t> scans { 0 };
+		std::atomic<uint64_t> batches { 0 };
+		std::atomic<uint64_t> accepted { 0 };
+		std::atomic<uint64_t> malformed { 0 };
+
+		// station by the local port of its connection
+		std::vector<std::atomic<int>> stationByPort = std::vector<std::atomic<int>>(65536);
+
+		// latencies per station, only touched by the collector thread until it stops
+		std::vector<std::vector<uint32_t>> latencies;
+
+		// latencies by tag priority, as latencies
+		std::vector<uint32_t> priorityLatencies[TAG_PRIORITY_HIGH + 1];
+
+		void begin(int stations);
+		void stop();
+
+	private:
+		int listener = -1;
+		int events = -1;
+
+		std::atomic<bool> running { true };
+		std::thread thread;
+
+		struct Connection {
+			int descriptor;
+			int station;
+			std::vector<uint8_t> buffer;
+		};
+
+		void run();
+		void receive(int descriptor, Connection *connection);
+};
+
+void Collector::begin(int stations) {
+	this->latencies.resize(stations);
+
+	for (auto &station : this->stationByPort) {
+		station = -1;
+	}
+
+	this->listener = socket(AF_INET, SOCK_STREAM, 0);
+
+	int enable = 1;
+	setsockopt(this->listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+	struct sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (
+		bind(this->listener, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+		listen(this->listener, 4096) != 0
+	) {
+		perror("collector");
+		exit(1);
+	}
+
+	socklen_t length = sizeof(address);
+	getsockname(this->listener, (struct sockaddr *)&address, &length);
+	this->port = ntohs(address.sin_port);
+
+	nonBlocking(this->listener);
+
+	this->events = epoll_create1(0);
+
+	struct epoll_event event = {};
+	event.events = EPOLLIN;
+	event.data.ptr = nullptr;
+	epoll_ctl(this->events, EPOLL_CTL_ADD, this->listener, &event);
+
+	this->thread = std::thread([this] { this->run(); });
+}
+
+void Collector::stop() {
+	this->running = false;
+	this->thread.join();
+}
+
+void Collector::receive(int descriptor, Connection *connection) {
+	uint8_t chunk[16384];
+
+	while (true) {
+		ssize_t length = recv(descriptor, chunk, sizeof(chunk), 0);
+
+		if (length == 0 || (length < 0 && errno != EAGAIN)) {
+			epoll_ctl(this->events, EPOLL_CTL_DEL, descriptor, nullptr);
+			close(descriptor);
+			delete connection;
+
+			return;
+		}
+
+		if (length < 0) {
+			break;
+		}
+
+		connection->buffer.insert(connection->buffer.end(), chunk, chunk + length);
+	}
+
+	int64_t time = now();
+	size_t offset = 0;
+
+	// batches are prefixed with their length
+	while (connection->buffer.size() - offset >= 2) {
+		size_t size = (connection->buffer[offset] << 8) | connection->buffer[offset + 1];
+
+		if (connection->buffer.size() - offset - 2 < size) {
+			break;
+		}
+
+		BatchDecoder decoder;
+
+		if (decoder.open(connection->buffer.data() + offset + 2, size)) {
+			while (decoder.next()) {
+				this->scans++;
+
+				// scan times are microseconds as on the station
+				uint32_t latency = time - decoder.time / 1000;
+
+				if (connection->station >= 0) {
+					this->latencies[connection->station].push_back(latency);
+				}
+
+				uint8_t family = classifyTag(&tagRules, decoder.tag, decoder.tagLength);
+				this->priorityLatencies[tagPriority(&tagRules, family)].push_back(latency);
+			}
+
+			this->batches++;
+		} else {
+			this->malformed++;
+		}
+
+		offset += 2 + size;
+	}
+
+	connection->buffer.erase(connection->buffer.begin(), connection->buffer.begin() + offset);
+}
+
+void Collector::run() {
+	struct epoll_event ready[256];
+
+	while (this->running) {
+		int count = epoll_wait(this->events, ready, 256, 10);
+
+		for (int index = 0; index < count; index++) {
+			Connection *connection = (Connection *)ready[index].data.ptr;
+
+			if (connection != nullptr) {
+				this->receive(connection->descriptor, connection);
+
+				continue;
+			}
+
+			// new stations
+			while (true) {
+				struct sockaddr_in address = {};
+				socklen_t length = sizeof(address);
+
+				int client = accept(this->listener, (struct sockaddr *)&address, &length);
+
+				if (client < 0) {
+					break;
+				}
+
+				nonBlocking(client);
+
+				connection = new Connection();
+				connection->descriptor = client;
+				connection->station = this->stationByPort[ntohs(address.sin_port)];
+
+				struct epoll_event event = {};
+				event.events = EPOLLIN;
+				event.data.ptr = connection;
+				epoll_ctl(this->events, EPOLL_CTL_ADD, client, &event);
+
+				this->accepted++;
+			}
+		}
+	}
+}
+
+// the stand-in, unused with an external collector
+Collector collector;
+
+static struct sockaddr_in collectorAddress = {};
+
+// give up on a connection attempt after this long
+#define CONNECT_TIMEOUT_MS 3000
+
+// the station blocks this long on a full send buffer before it drops the connection
+#define SEND_TIMEOUT_MS 1000
+
+typedef enum {
+	STATION_DOWN,
+	STATION_CONNECTING,
+	STATION_UP,
+} station_state_t;
+
+// totals of every station, the event loop is single threaded
+struct Totals {
+	uint64_t generated = 0;
+	uint64_t arenaOverflow = 0;
+	uint64_t queueOverflow = 0;
+
+	// low priority scans turned away from the second half of the queue
+	uint64_t queueYield = 0;
+	uint64_t urgent = 0;
+	uint64_t dropped = 0;
+
+	uint64_t sent = 0;
+	uint64_t batches = 0;
+	uint64_t bytes = 0;
+
+	uint64_t attempts = 0;
+	uint64_t connects = 0;
+	uint64_t failures = 0;
+	uint64_t connected = 0;
+};
+
+static Totals totals;
+
+// one virtual station: scanner, record arena, uplink queue and batching as on the firmware
+class Station {
+	public:
+		int id = 0;
+		station_state_t state = STATION_DOWN;
+
+		void begin(int id, int epoll, std::mt19937 *random);
+		void step(int64_t time);
+
+		// link failure until the given time
+		void fail(int64_t until);
+
+		// socket readiness
+		void ready(uint32_t events, int64_t time);
+
+	private:
+		alignas(RECORD_ALIGNMENT) uint8_t memory[RECORD_ARENA_SIZE];
+		RecordArena arena;
+
+		// the uplink queue
+		std::deque<ScanRecord *> queue;
+
+		// the batch being built, held while a connection comes up
+		BatchEncoder encoder;
+		uint8_t buffer[BATCH_SIZE_LIMIT];
+		bool open = false;
+		bool full = false;
+
+		// a high priority scan is in the batch, it goes out without waiting
+		bool urgent = false;
+		int64_t deadline = 0;
+
+		// framed batches not yet taken by the socket
+		std::vector<uint8_t> out;
+		uint32_t outScans = 0;
+		int64_t blockedSince = -1;
+
+		int descriptor = -1;
+		int epoll = -1;
+		int64_t lastAttempt = INT64_MIN / 2;
+		int64_t linkDownUntil = 0;
+		int64_t nextFailure = INT64_MAX;
+
+		int64_t nextScan = 0;
+		int burstLeft = 0;
+		uint64_t serial = 0;
+		size_t traceIndex = 0;
+
+		std::mt19937 *random = nullptr;
+
+		void scan(int64_t time);
+		void batch(int64_t time);
+
+		bool connect(int64_t time);
+		void connected();
+		void disconnect();
+		void flush(int64_t time);
+
+		int64_t exponential(double mean);
+};
+
+int64_t Station::exponential(double mean) {
+	std::exponential_distribution<double> distribution(1.0 / mean);
+
+	return (int64_t)distribution(*this->random);
+}
+
+void Station::begin(int id, int epoll, std::mt19937 *random) {
+	this->id = id;
+	this->epoll = epoll;
+	this->random = random;
+
+	this->arena.begin(this->memory, sizeof(this->memory));
+
+	// stations do not start in lockstep
+	this->nextScan = this->exponential(1000.0 * options.burst / options.rate);
+	this->serial = (uint64_t)id * 1000000;
+	this->traceIndex = trace.empty() ? 0 : (*random)() % trace.size();
+
+	if (options.failEvery > 0) {
+		this->nextFailure = this->exponential(options.failEvery * 1000);
+	}
+}
+
+void Station::scan(int64_t time) {
+	while (time >= this->nextScan) {
+		char tag[64];
+		const char *data = tag;
+		uint32_t length;
+
+		if (trace.empty()) {
+			length = snprintf(tag, sizeof(tag), "ST%05d-%010llu", this->id, (unsigned long long)this->serial++);
+		} else {
+			const std::string &line = trace[this->traceIndex++ % trace.size()];
+
+			data = line.data();
+			length = line.size();
+		}
+
+		totals.generated++;
+
+		// scans are timestamped and classified on completion as in scanComplete
+		ScanRecord *record = this->arena.commit(data, length, "", this->nextScan * 1000, 1);
+
+		if (record != nullptr) {
+			record->family = classifyTag(&tagRules, record->data(), record->length);
+		}
+
+		if (record == nullptr) {
+			totals.arenaOverflow++;
+		} else if (
+			tagPriority(&tagRules, record->family) == TAG_PRIORITY_LOW &&
+			this->queue.size() >= UPLINK_LOW_PRIORITY_LIMIT
+		) {
+			totals.queueYield++;
+			recordRelease(record);
+		} else if (this->queue.size() >= UPLINK_QUEUE_LENGTH) {
+			totals.queueOverflow++;
+			recordRelease(record);
+		} else {
+			this->queue.push_back(record);
+		}
+
+		// scans of a burst follow each other closely, bursts keep the average rate
+		if (this->burstLeft > 0) {
+			this->burstLeft--;
+			this->nextScan += 20 + this->exponential(10);
+		} else {
+			this->burstLeft = options.burst - 1;
+			this->nextScan += this->exponential(1000.0 * options.burst / options.rate);
+		}
+	}
+}
+
+void Station::batch(int64_t time) {
+	while (true) {
+		// a scan that did not fit opens the next batch, as in Uplink::run
+		while (!this->full && !this->urgent && !this->queue.empty() && (!this->open || this->encoder.count < BATCH_RECORD_LIMIT)) {
+			ScanRecord *record = this->queue.front();
+
+			if (!this->open) {
+				this->encoder.begin(this->buffer, BATCH_SIZE_LIMIT, record->time);
+				this->open = true;
+				this->deadline = time + BATCH_LATENCY_MS;
+			}
+
+			if (!this->encoder.append(record->data(), record->length, record->time)) {
+				this->full = true;
+
+				break;
+			}
+
+			this->urgent = tagPriority(&tagRules, record->family) == TAG_PRIORITY_HIGH;
+
+			this->queue.pop_front();
+			recordRelease(record);
+		}
+
+		if (!this->open || (!this->full && !this->urgent && this->encoder.count < BATCH_RECORD_LIMIT && time < this->deadline)) {
+			return;
+		}
+
+		// the firmware blocks in connect with the batch in hand
+		if (this->state == STATION_CONNECTING) {
+			return;
+		}
+
+		if (this->state == STATION_DOWN && this->connect(time)) {
+			return;
+		}
+
+		size_t length = this->encoder.finish();
+
+		if (this->state == STATION_UP) {
+			this->out.push_back(length >> 8);
+			this->out.push_back(length & 0xff);
+			this->out.insert(this->out.end(), this->buffer, this->buffer + length);
+			this->outScans += this->encoder.count;
+
+			totals.batches++;
+			totals.bytes += length;
+			totals.urgent += this->urgent;
+
+			this->flush(time);
+		} else {
+			totals.dropped += this->encoder.count;
+		}
+
+		this->open = false;
+		this->full = false;
+		this->urgent = false;
+	}
+}
+
+void Station::step(int64_t time) {
+	if (time >= this->nextFailure) {
+		this->fail(time + options.failFor * 1000);
+		this->nextFailure = time + this->exponential(options.failEvery * 1000);
+	}
+
+	if (this->state == STATION_CONNECTING && time - this->lastAttempt >= CONNECT_TIMEOUT_MS) {
+		this->disconnect();
+	}
+
+	if (this->blockedSince >= 0 && time - this->blockedSince >= SEND_TIMEOUT_MS) {
+		this->disconnect();
+	}
+
+	this->scan(time);
+	this->batch(time);
+}
+
+void Station::fail(int64_t until) {
+	totals.failures++;
+
+	this->disconnect();
+	this->linkDownUntil = until;
+}
+
+// true if an attempt was started
+bool Station::connect(int64_t time) {
+	if (time < this->linkDownUntil || time - this->lastAttempt < options.retry) {
+		return false;
+	}
+
+	this->lastAttempt = time;
+	totals.attempts++;
+
+	int descriptor = socket(AF_INET, SOCK_STREAM, 0);
+
+	if (descriptor < 0) {
+		return false;
+	}
+
+	nonBlocking(descriptor);
+
+	int enable = 1;
+	setsockopt(descriptor, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+	// the port is known before the collector can accept, so the stand-in can tell stations apart
+	struct sockaddr_in local = {};
+	local.sin_family = AF_INET;
+	socklen_t length = sizeof(local);
+
+	if (
+		bind(descriptor, (struct sockaddr *)&local, sizeof(local)) != 0 ||
+		getsockname(descriptor, (struct sockaddr *)&local, &length) != 0
+	) {
+		close(descriptor);
+
+		return false;
+	}
+
+	collector.stationByPort[ntohs(local.sin_port)] = this->id;
+
+	if (
+		::connect(descriptor, (struct sockaddr *)&collectorAddress, sizeof(collectorAddress)) != 0 &&
+		errno != EINPROGRESS
+	) {
+		close(descriptor);
+
+		return false;
+	}
+
+	this->descriptor = descriptor;
+	this->state = STATION_CONNECTING;
+
+	struct epoll_event event = {};
+	event.events = EPOLLOUT;
+	event.data.u32 = this->id;
+	epoll_ctl(this->epoll, EPOLL_CTL_ADD, descriptor, &event);
+
+	return true;
+}
+
+void Station::connected() {
+	this->state = STATION_UP;
+
+	totals.connects++;
+	totals.connected++;
+
+	// from now on only a closed connection is of interest, until the send buffer fills
+	struct epoll_event event = {};
+	event.events = EPOLLIN | EPOLLRDHUP;
+	event.data.u32 = this->id;
+	epoll_ctl(this->epoll, EPOLL_CTL_MOD, this->descriptor, &event);
+}
+
+void Station::disconnect() {
+	if (this->descriptor < 0) {
+		return;
+	}
+
+	if (this->state == STATION_UP) {
+		totals.connected--;
+	}
+
+	epoll_ctl(this->epoll, EPOLL_CTL_DEL, this->descriptor, nullptr);
+	close(this->descriptor);
+
+	this->descriptor = -1;
+	this->state = STATION_DOWN;
+
+	// whatever the socket did not take is lost
+	totals.dropped += this->outScans;
+
+	this->out.clear();
+	this->outScans = 0;
+	this->blockedSince = -1;
+}
+
+void Station::flush(int64_t time) {
+	size_t offset = 0;
+
+	while (offset < this->out.size()) {
+		ssize_t length = send(this->descriptor, this->out.data() + offset, this->out.size() - offset, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+		if (length < 0) {
+			break;
+		}
+
+		offset += length;
+	}
+
+	if (offset == this->out.size()) {
+		totals.sent += this->outScans;
+
+		this->out.clear();
+		this->outScans = 0;
+
+		if (this->blockedSince >= 0) {
+			this->blockedSince = -1;
+
+			struct epoll_event event = {};
+			event.events = EPOLLIN | EPOLLRDHUP;
+			event.data.u32 = this->id;
+			epoll_ctl(this->epoll, EPOLL_CTL_MOD, this->descriptor, &event);
+		}
+
+		return;
+	}
+
+	if (errno != EAGAIN && errno != EWOULDBLOCK) {
+		this->disconnect();
+
+		return;
+	}
+
+	this->out.erase(this->out.begin(), this->out.begin() + offset);
+
+	if (this->blockedSince < 0) {
+		this->blockedSince = time;
+
+		struct epoll_event event = {};
+		event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP;
+		event.data.u32 = this->id;
+		epoll_ctl(this->epoll, EPOLL_CTL_MOD, this->descriptor, &event);
+	}
+}
+
+void Station::ready(uint32_t events, int64_t time) {
+	if (this->state == STATION_CONNECTING) {
+		int error = 0;
+		socklen_t length = sizeof(error);
+		getsockopt(this->descriptor, SOL_SOCKET, SO_ERROR, &error, &length);
+
+		if (error != 0 || (events & (EPOLLERR | EPOLLHUP))) {
+			this->disconnect();
+		} else {
+			this->connected();
+		}
+
+		return;
+	}
+
+	// the collector never talks back, readable means closed
+	if (events & (EPOLLIN | EPOLLRDHUP | EPOLLERR | EPOLLHUP)) {
+		this->disconnect();
+
+		return;
+	}
+
+	if (events & EPOLLOUT) {
+		this->flush(time);
+	}
+}
+
+static bool parseOptions(int count, char **arguments) {
+	for (int index = 1; index < count; index++) {
+		std::string name = arguments[index];
+
+		if (index + 1 >= count) {
+			return false;
+		}
+
+		const char *value = arguments[++index];
+
+		if (name == "--stations") {
+			options.stations = atoi(value);
+		} else if (name == "--duration") {
+			options.duration = atof(value);
+		} else if (name == "--rate") {
+			options.rate = atof(value);
+		} else if (name == "--burst") {
+			options.burst = std::max(1, atoi(value));
+		} else if (name == "--trace") {
+			options.trace = value;
+		} else if (name == "--collector") {
+			options.collector = value;
+		} else if (name == "--fail-every") {
+			options.failEvery = atof(value);
+		} else if (name == "--fail-for") {
+			options.failFor = atof(value);
+		} else if (name == "--outage-at") {
+			options.outageAt = atof(value);
+		} else if (name == "--outage-for") {
+			options.outageFor = atof(value);
+		} else if (name == "--retry") {
+			options.retry = atoi(value);
+		} else {
+			return false;
+		}
+	}
+
+	return options.stations > 0 && options.stations <= 65535 && options.rate > 0;
+}
+
+static bool loadTrace() {
+	if (options.trace.empty()) {
+		return true;
+	}
+
+	std::ifstream file(options.trace);
+	std::string line;
+
+	while (std::getline(file, line)) {
+		if (!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+
+		if (!line.empty()) {
+			trace.push_back(line.substr(0, RECORD_LENGTH_LIMIT));
+		}
+	}
+
+	return !trace.empty();
+}
+
+static bool resolveCollector() {
+	collectorAddress.sin_family = AF_INET;
+
+	if (options.collector.empty()) {
+		collector.begin(options.stations);
+
+		collectorAddress.sin_port = htons(collector.port);
+		collectorAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+		return true;
+	}
+
+	size_t colon = options.collector.rfind(':');
+
+	if (colon == std::string::npos) {
+		return false;
+	}
+
+	collectorAddress.sin_port = htons(atoi(options.collector.c_str() + colon + 1));
+
+	return inet_pton(AF_INET, options.collector.substr(0, colon).c_str(), &collectorAddress.sin_addr) == 1;
+}
+
+static void report(const std::vector<uint32_t> &connectsPerSecond) {
+	printf("\n");
+	printf("scans      generated %llu, sent %llu, dropped %llu\n",
+		(unsigned long long)totals.generated,
+		(unsigned long long)totals.sent,
+		(unsigned long long)totals.dropped
+	);
+	printf("overflow   arena %llu, queue %llu, low priority yield %llu\n",
+		(unsigned long long)totals.arenaOverflow,
+		(unsigned long long)totals.queueOverflow,
+		(unsigned long long)totals.queueYield
+	);
+	printf("batches    %llu, %.1f scans and %.0f bytes per batch, %llu closed by a high priority scan\n",
+		(unsigned long long)totals.batches,
+		totals.batches ? (double)totals.sent / totals.batches : 0,
+		totals.batches ? (double)totals.bytes / totals.batches : 0,
+		(unsigned long long)totals.urgent
+	);
+
+	uint32_t peak = connectsPerSecond.empty() ? 0 : *std::max_element(connectsPerSecond.begin(), connectsPerSecond.end());
+
+	printf("links      %llu attempts, %llu connects, %llu failures, peak %u connects/s\n",
+		(unsigned long long)totals.attempts,
+		(unsigned long long)totals.connects,
+		(unsigned long long)totals.failures,
+		peak
+	);
+
+	if (!options.collector.empty()) {
+		return;
+	}
+
+	printf("collector  %llu scans, %llu batches, %llu connections, %llu malformed\n",
+		(unsigned long long)collector.scans,
+		(unsigned long long)collector.batches,
+		(unsigned long long)collector.accepted,
+		(unsigned long long)collector.malformed
+	);
+
+	std::vector<uint32_t> all;
+	std::vector<uint32_t> stationP99;
+
+	for (auto &latencies : collector.latencies) {
+		if (latencies.empty()) {
+			continue;
+		}
+
+		all.insert(all.end(), latencies.begin(), latencies.end());
+		stationP99.push_back(percentileOf(latencies, 0.99));
+	}
+
+	printf("latency ms p50 %d, p90 %d, p99 %d, p999 %d, max %d\n",
+		percentileOf(all, 0.5),
+		percentileOf(all, 0.9),
+		percentileOf(all, 0.99),
+		percentileOf(all, 0.999),
+		percentileOf(all, 1)
+	);
+
+	printf("station p99 ms p50 %d, p90 %d, max %d\n",
+		percentileOf(stationP99, 0.5),
+		percentileOf(stationP99, 0.9),
+		percentileOf(stationP99, 1)
+	);
+
+	const char *priorityNames[] = { "low", "normal", "high" };
+
+	for (int priority = TAG_PRIORITY_LOW; priority <= TAG_PRIORITY_HIGH; priority++) {
+		std::vector<uint32_t> &latencies = collector.priorityLatencies[priority];
+
+		if (latencies.empty()) {
+			continue;
+		}
+
+		printf("%-6s ms  p50 %d, p99 %d, max %d over %zu scans\n",
+			priorityNames[priority],
+			percentileOf(latencies, 0.5),
+			percentileOf(latencies, 0.99),
+			percentileOf(latencies, 1),
+			latencies.size()
+		);
+	}
+}
+
+int main(int count, char **arguments) {
+	if (!parseOptions(count, arguments)) {
+		fprintf(stderr, "usage: %s [--stations N] [--duration S] [--rate R] [--burst N] [--trace FILE]\n", arguments[0]);
+		fprintf(stderr, "  [--collector H:P] [--fail-every S] [--fail-for S] [--outage-at S] [--outage-for S] [--retry MS]\n");
+
+		return 1;
+	}
+
+	if (!loadTrace()) {
+		fprintf(stderr, "unable to read trace %s\n", options.trace.c_str());
+
+		return 1;
+	}
+
+	// one socket per station on each side
+	struct rlimit limit;
+	getrlimit(RLIMIT_NOFILE, &limit);
+	limit.rlim_cur = limit.rlim_max;
+	setrlimit(RLIMIT_NOFILE, &limit);
+
+	if (!resolveCollector()) {
+		fprintf(stderr, "invalid collector %s\n", options.collector.c_str());
+
+		return 1;
+	}
+
+	int epoll = epoll_create1(0);
+	std::mt19937 random(1);
+
+	std::vector<std::unique_ptr<Station>> stations;
+
+	for (int id = 0; id < options.stations; id++) {
+		stations.emplace_back(new Station());
+		stations.back()->begin(id, epoll, &random);
+	}
+
+	printf("%d stations, %.1f scans/s each, batches of up to %d scans, %d bytes or %d ms\n",
+		options.stations, options.rate, BATCH_RECORD_LIMIT, BATCH_SIZE_LIMIT, BATCH_LATENCY_MS
+	);
+	printf("%6s %10s %10s %10s %10s %10s\n", "second", "scans/s", "batches/s", "dropped/s", "connects/s", "connected");
+
+	std::vector<uint32_t> connectsPerSecond;
+	struct epoll_event ready[1024];
+
+	Totals previous = totals;
+	int64_t end = options.duration * 1000;
+	int64_t nextReport = 1000;
+	int64_t lastStep = -1;
+	bool outage = false;
+
+	while (true) {
+		int64_t time = now();
+
+		if (time >= end) {
+			break;
+		}
+
+		if (options.outageAt > 0 && !outage && time >= options.outageAt * 1000) {
+			outage = true;
+
+			for (auto &station : stations) {
+				station->fail(time + options.outageFor * 1000);
+			}
+		}
+
+		// stations run on a millisecond tick, like the firmware on its queues
+		if (time != lastStep) {
+			lastStep = time;
+
+			for (auto &station : stations) {
+				station->step(time);
+			}
+		}
+
+		int events = epoll_wait(epoll, ready, 1024, 1);
+
+		for (int index = 0; index < events; index++) {
+			stations[ready[index].data.u32]->ready(ready[index].events, now());
+		}
+
+		if (time >= nextReport) {
+			printf("%6lld %10llu %10llu %10llu %10llu %10llu\n",
+				(long long)(nextReport / 1000),
+				(unsigned long long)(totals.sent - previous.sent),
+				(unsigned long long)(totals.batches - previous.batches),
+				(unsigned long long)(totals.dropped - previous.dropped),
+				(unsigned long long)(totals.connects - previous.connects),
+				(unsigned long long)totals.connected
+			);
+			fflush(stdout);
+
+			connectsPerSecond.push_back(totals.connects - previous.connects);
+
+			previous = totals;
+			nextReport += 1000;
+		}
+	}
+
+	// give the collector a moment for the data in flight
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+	if (options.collector.empty()) {
+		collector.stop();
+	}
+
+	report(connectsPerSecond);
+
+	return 0;
+}
@@ -0,0 +1,332 @@
+// trace dump to Chrome trace JSON, opens in Perfetto or chrome://tracing
+//
+// the station records with TRACE_ENABLED, see firmware/main/trace.h, and serves the dump
+// on the metrics port
+//
+// build:
+//
+//   g++ -std=c++17 -O2 -I../firmware/main index.cpp -o trace
+//
+// usage:
+//
+//   curl -o dump.bin http://STATION:9100/trace
+//   ./trace dump.bin > trace.json
+//
+// one track per core shows which task ran, one track per task shows its run slices,
+// queue and notification events and the markers
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "trace.h"
+
+// process ids in the output
+#define TRACE_PROCESS_CORES 1
+#define TRACE_PROCESS_TASKS 2
+
+struct Core {
+	TraceCore state;
+	std::vector<TraceEvent> events;
+
+	// cycles per microsecond
+	double rate;
+
+	// cycles to microseconds since boot
+	double microseconds(uint64_t cycles) const {
+		return this->state.start.time + (double)(int64_t)(cycles - this->state.start.cycles) / this->rate;
+	}
+};
+
+static TraceHeader header;
+static std::vector<Core> cores;
+static std::map<uint32_t, std::string> names;
+
+// output thread per task, in order of appearance
+static std::map<uint32_t, int> threads;
+
+static bool first = true;
+
+static const char *markName(uint16_t mark) {
+	switch (mark) {
+		case TRACE_MARK_SCAN: return "scan";
+		case TRACE_MARK_RENDER: return "render";
+		case TRACE_MARK_TRANSFER: return "transfer";
+		case TRACE_MARK_UPLINK: return "uplink";
+	}
+
+	return "mark";
+}
+
+static const char *eventName(uint8_t type) {
+	switch (type & ~TRACE_FROM_ISR) {
+		case TRACE_QUEUE_SEND: return "queue send";
+		case TRACE_QUEUE_RECEIVE: return "queue receive";
+		case TRACE_QUEUE_BLOCK_SEND: return "blocked on send";
+		case TRACE_QUEUE_BLOCK_RECEIVE: return "blocked on receive";
+		case TRACE_NOTIFY: return "notify";
+		case TRACE_NOTIFY_WAIT: return "notified";
+	}
+
+	return "event";
+}
+
+static std::string taskName(uint32_t handle) {
+	auto found = names.find(handle);
+
+	if (found != names.end()) {
+		return found->second;
+	}
+
+	char name[16];
+	snprintf(name, sizeof(name), "0x%08x", handle);
+
+	return name;
+}
+
+static int taskThread(uint32_t handle) {
+	auto found = threads.find(handle);
+
+	if (found != threads.end()) {
+		return found->second;
+	}
+
+	int thread = threads.size() + 1;
+	threads[handle] = thread;
+
+	return thread;
+}
+
+// every output event is one line
+static void emit(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+static void emit(const char *format, ...) {
+	printf(first ? "\n\t" : ",\n\t");
+	first = false;
+
+	va_list arguments;
+	va_start(arguments, format);
+	vprintf(format, arguments);
+	va_end(arguments);
+}
+
+static void slice(int process, int thread, const std::string &name, double start, double end, int core) {
+	emit(
+		"{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"core\":%d}}",
+		name.c_str(), process, thread, start, end - start, core
+	);
+}
+
+static bool load(const char *path) {
+	FILE *file = fopen(path, "rb");
+
+	if (file == NULL) {
+		perror(path);
+
+		return false;
+	}
+
+	bool valid =
+		fread(&header, sizeof(header), 1, file) == 1 &&
+		memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) == 0 &&
+		header.events > 0 && (header.events & (header.events - 1)) == 0;
+
+	for (uint16_t index = 0; valid && index < header.cores; index++) {
+		Core core;
+
+		core.events.resize(header.events);
+
+		valid =
+			fread(&core.state, sizeof(core.state), 1, file) == 1 &&
+			fread(core.events.data(), sizeof(TraceEvent), header.events, file) == header.events;
+
+		// the anchors give the rate the counter actually ran at
+		uint64_t cycles = core.state.end.cycles - core.state.start.cycles;
+		int64_t time = core.state.end.time - core.state.start.time;
+
+		core.rate = cycles > 0 && time > 0 ? (double)cycles / time : header.frequency / 1e6;
+
+		cores.push_back(core);
+	}
+
+	for (uint16_t index = 0; valid && index < header.taskCount; index++) {
+		TraceTask task;
+
+		valid = fread(&task, sizeof(task), 1, file) == 1;
+
+		// names are not terminated when they fill the field
+		names[task.handle] = std::string(task.name, strnlen(task.name, TRACE_NAME_SIZE));
+	}
+
+	fclose(file);
+
+	if (!valid) {
+		fprintf(stderr, "%s: not a trace dump\n", path);
+	}
+
+	return valid;
+}
+
+struct Entry {
+	double time;
+	int core;
+	const TraceEvent *event;
+};
+
+// the rings of all cores in time order, tasks without affinity move between cores
+static std::vector<Entry> merge() {
+	std::vector<Entry> entries;
+
+	for (int index = 0; index < (int)cores.size(); index++) {
+		const Core &core = cores[index];
+
+		uint32_t count = core.state.head < header.events ? core.state.head : header.events;
+		uint32_t oldest = core.state.head - count;
+
+		for (uint32_t position = oldest; position != core.state.head; position++) {
+			const TraceEvent *event = &core.events[position & (header.events - 1)];
+
+			entries.push_back({ core.microseconds(event->cycles), index, event });
+		}
+
+		fprintf(stderr, "core %d: %u events, %u overwritten, %.1f ms\n",
+			index, count, oldest,
+			count > 0 ? (core.state.end.time - core.microseconds(core.events[oldest & (header.events - 1)].cycles)) / 1000 : 0.0
+		);
+	}
+
+	std::stable_sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+		return a.time < b.time;
+	});
+
+	return entries;
+}
+
+// task running on a core, events before its first switch cannot be attributed
+struct Running {
+	uint32_t task;
+	bool known;
+	double since;
+};
+
+static void convert() {
+	std::vector<Running> running(cores.size(), { 0, false, 0 });
+
+	// open markers per task, an end whose begin was overwritten is dropped
+	std::map<uint32_t, int> depth;
+
+	for (const Entry &entry : merge()) {
+		const TraceEvent &event = *entry.event;
+		Running &core = running[entry.core];
+
+		if (event.type == TRACE_SWITCH_IN) {
+			if (core.known && event.object != core.task) {
+				slice(TRACE_PROCESS_CORES, entry.core, taskName(core.task), core.since, entry.time, entry.core);
+				slice(TRACE_PROCESS_TASKS, taskThread(core.task), "running", core.since, entry.time, entry.core);
+			}
+
+			if (!core.known || event.object != core.task) {
+				core.since = entry.time;
+			}
+
+			core.task = event.object;
+			core.known = true;
+
+			continue;
+		}
+
+		if (!core.known) {
+			continue;
+		}
+
+		uint8_t type = event.type & ~TRACE_FROM_ISR;
+
+		if (type == TRACE_MARK_BEGIN || type == TRACE_MARK_END) {
+			int &open = depth[core.task];
+
+			if (type == TRACE_MARK_END && open == 0) {
+				continue;
+			}
+
+			open += type == TRACE_MARK_BEGIN ? 1 : -1;
+
+			emit(
+				"{\"name\":\"%s\",\"ph\":\"%s\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f}",
+				markName(event.value), type == TRACE_MARK_BEGIN ? "B" : "E",
+				TRACE_PROCESS_TASKS, taskThread(core.task), entry.time
+			);
+
+			continue;
+		}
+
+		// interrupts show on the core, everything else on the task that ran
+		bool interrupt = event.type & TRACE_FROM_ISR;
+
+		// queues have no names, they show as their handle
+		std::string object = type == TRACE_NOTIFY_WAIT ? "" : taskName(event.object);
+
+		emit(
+			"{\"name\":\"%s%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"args\":{\"object\":\"%s\",\"value\":%u}}",
+			eventName(event.type), interrupt ? " from isr" : "",
+			interrupt ? TRACE_PROCESS_CORES : TRACE_PROCESS_TASKS,
+			interrupt ? entry.core : taskThread(core.task),
+			entry.time, object.c_str(), event.value
+		);
+	}
+
+	// the last tasks ran until the dump was taken
+	for (int index = 0; index < (int)cores.size(); index++) {
+		if (running[index].known) {
+			double end = cores[index].state.end.time;
+
+			slice(TRACE_PROCESS_CORES, index, taskName(running[index].task), running[index].since, end, index);
+			slice(TRACE_PROCESS_TASKS, taskThread(running[index].task), "running", running[index].since, end, index);
+		}
+	}
+}
+
+int main(int count, char **arguments) {
+	if (count != 2) {
+		fprintf(stderr, "usage: %s DUMP > trace.json\n", arguments[0]);
+
+		return 1;
+	}
+
+	if (!load(arguments[1])) {
+		return 1;
+	}
+
+	printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+	convert();
+
+	emit("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"cores\"}}", TRACE_PROCESS_CORES);
+	emit("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"tasks\"}}", TRACE_PROCESS_TASKS);
+
+	for (int index = 0; index < (int)cores.size(); index++) {
+		emit("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"core %d\"}}", TRACE_PROCESS_CORES, index, index);
+	}
+
+	for (const auto &thread : threads) {
+		emit(
+			"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+			TRACE_PROCESS_TASKS, thread.second, taskName(thread.first).c_str()
+		);
+	}
+
+	printf("\n]}\n");
+
+	fprintf(stderr, "recording overhead %u cycles per event, %.0f ns at %u MHz\n",
+		header.overhead,
+		header.overhead * 1e3 / (header.frequency / 1e6),
+		header.frequency / 1000000
+	);
+
+	return 0;
+}